@@ -32,8 +32,12 @@ SOFTWARE.
 #include <string.h>
 #include <lvgl.h>
 //#include <app/drivers/blink.h>
+#include <app/drivers/display/display_st7735s.h>
 #include <app/lib/lv_compass.h>
 #include <app/lib/lv_pitch_ladder.h>
+#ifdef CONFIG_APP_HUD_COMPOSITE
+#include <app/lib/lv_hud.h>
+#endif
 #include <app_version.h>
 
 LOG_MODULE_REGISTER(main, CONFIG_APP_LOG_LEVEL);
@@ -69,8 +73,12 @@ typedef struct {
     param_t  * params;
 } screens_t;
 
+static const struct device *display_dev = DEVICE_DT_GET(DT_CHOSEN(zephyr_display));
 static lv_obj_t   * compass_obj;
 static lv_obj_t   * pitch_ladder_obj;
+#ifdef CONFIG_APP_HUD_COMPOSITE
+static lv_obj_t   * hud_obj;
+#endif
 static short        compass_value;
 static short        pitch_ladder_pitch;
 static param_t screen0_elements [] = {
@@ -88,6 +96,7 @@ struct sensor_value gyr[3];
  **********************/
 void read_gyro_data(const struct device * gyro_dev);
 void display_gyro_data(void);
+void hud_set_style(screen_style_t style);
 void hud_set_type(screen_style_t style);
 void hud_set_line_width(lv_coord_t width);
 int sensing(void);
@@ -106,21 +115,66 @@ void display_gyro_data(void)
 {
 	k_mutex_lock(&gyro_data_mutex, K_FOREVER);
 	//printk("Roll %d pitch %d \n", gyr[2].val1*10, gyr[1].val1);
+#ifdef CONFIG_APP_HUD_COMPOSITE
+	lv_hud_set_attitude(hud_obj, gyr[0].val1, gyr[1].val1, gyr[2].val1*10);
+#else
 	lv_pitch_ladder_set_angles(pitch_ladder_obj, gyr[1].val1 , gyr[2].val1*10);
 	lv_compass_angle(compass_obj, gyr[0].val1);
+#endif
 	k_mutex_unlock(&gyro_data_mutex);
 }
-void hud_set_type(screen_style_t style){
+void hud_set_style(screen_style_t style){
+	lv_obj_set_style_bg_opa(lv_scr_act(), LV_OPA_COVER, LV_PART_MAIN);
 	if(style == DARK){
-		lv_obj_set_style_bg_opa(lv_scr_act(), LV_OPA_COVER, LV_PART_MAIN);
 		lv_obj_set_style_bg_color(lv_scr_act(), lv_color_black(), LV_PART_MAIN);
 		lv_pitch_ladder_set_dark_style(pitch_ladder_obj);
 		lv_compass_set_dark_style(compass_obj);
 	}else{
+		lv_obj_set_style_bg_color(lv_scr_act(), lv_color_white(), LV_PART_MAIN);
 		lv_pitch_ladder_set_light_style(pitch_ladder_obj);
 		lv_compass_set_light_style(compass_obj);
 	}
 }
+/* The color INVON shows as c, the panel inverts every pixel bit */
+static lv_color_t hud_negative(lv_color_t c)
+{
+	c.full = ~c.full;
+	return c;
+}
+/*
+ * Switch the theme with the panel inversion where possible.
+ * DARK:  blue symbology on black, inversion off.
+ * LIGHT: rendered as white symbology on black, the negative of the light
+ *        style, and shown inverted (INVON) as black on white. Inverting
+ *        the blue dark style instead would give yellow on white. The
+ *        horizon fill is the negative of the light sky and ground, so
+ *        the panel shows light blue above and tan below the horizon
+ *        rather than swapping them.
+ * Without inversion support LIGHT falls back to drawing the light style.
+ */
+void hud_set_type(screen_style_t style){
+	if(st7735s_set_inversion(display_dev, style == LIGHT) < 0){
+		hud_set_style(style);
+		return;
+	}
+	hud_set_style(DARK);
+	if(style == LIGHT){
+		lv_pitch_ladder_set_color(pitch_ladder_obj, lv_color_white());
+		lv_compass_set_color(compass_obj, lv_color_white());
+		lv_pitch_ladder_set_horizon_colors(pitch_ladder_obj,
+			hud_negative(LV_PITCH_LADDER_LIGHT_SKY),
+			hud_negative(LV_PITCH_LADDER_LIGHT_GROUND));
+	}
+	/* Alternate gamma is optional */
+	st7735s_set_gamma(display_dev, style == LIGHT);
+}
+#ifdef CONFIG_ST7735S_FRAME_SYNC
+/* Called once all areas of a refresh are flushed */
+static void hud_frame_done(lv_disp_drv_t * disp_drv, uint32_t time, uint32_t px)
+{
+	st7735s_frame_done(display_dev);
+}
+#endif
 void hud_set_line_width(lv_coord_t width)
 {
 	lv_compass_set_line_width(compass_obj, 2);
@@ -142,7 +196,6 @@ int sensing(void)
 }
 int display(void)
 {
-	const struct device *display_dev = DEVICE_DT_GET(DT_CHOSEN(zephyr_display));
 	printk("Zephyr tinyHUD Application %s\n", APP_VERSION_STRING);
     if (display_dev == NULL) {
         LOG_ERR("Display device not found.");
@@ -153,11 +206,26 @@ int display(void)
 	//printk("Screen size: %d, %d", lv_obj_get_height(screens[0].screen), lv_obj_get_width(screens[0].screen));
 	lv_scr_load(screens[0].screen);
 
+#ifdef CONFIG_APP_HUD_COMPOSITE
+	hud_obj = lv_hud_create(lv_scr_act());
+	pitch_ladder_obj = lv_hud_get_pitch_ladder(hud_obj);
+	compass_obj = lv_hud_get_compass(hud_obj);
+#else
 	pitch_ladder_obj = lv_pitch_ladder_create(lv_scr_act());
 	compass_obj = lv_compass_create(lv_scr_act());
+#endif
 
-	hud_set_type(DARK);
+	hud_set_type(IS_ENABLED(CONFIG_APP_HUD_LIGHT) ? LIGHT : DARK);
 	hud_set_line_width(2);
+#ifdef CONFIG_APP_HUD_COMPOSITE
+	/* The parts are hidden, styling them does not invalidate */
+	lv_obj_invalidate(hud_obj);
+#endif
+
+#ifdef CONFIG_ST7735S_FRAME_SYNC
+	/* Wait for the panel frame start once per refresh, not per area */
+	lv_disp_get_default()->driver->monitor_cb = hud_frame_done;
+#endif
 
 	//display_set_brightness(display_dev, 255);
 	//display_set_orientation(display_dev, DISPLAY_ORIENTATION_ROTATED_90);
@@ -19,38 +19,91 @@
 #include <zephyr/drivers/gpio.h>
 #include <zephyr/pm/device.h>
 #include <zephyr/sys/byteorder.h>
+#include <zephyr/sys/util.h>
+#include <zephyr/toolchain.h>
 #include <zephyr/drivers/display.h>
+#include <string.h>
+
+#if defined(CONFIG_ST7735S_SWAP_RGB565) && defined(CONFIG_CPU_CORTEX_M)
+#include <cmsis_core.h>
+#endif
 
 #include <zephyr/logging/log.h>
 LOG_MODULE_REGISTER(display_st7735s, CONFIG_DISPLAY_LOG_LEVEL);
 
 #define ST7735S_RESET_TIME              K_MSEC(1)
 #define ST7735S_EXIT_SLEEP_TIME K_MSEC(120)
+/* SLPOUT: next command after 5 ms, SLPIN no earlier than 120 ms */
+#define ST7735S_SLEEP_OUT_CMD_DELAY     K_MSEC(5)
+#define ST7735S_SLEEP_OUT_SLEEP_IN_DELAY K_MSEC(120)
 
 #define ST7735S_PIXEL_SIZE 2u
 
+#define ST7735S_GAMMA_SIZE 16u
+
+#ifdef CONFIG_ST7735S_TILE_DIFF
+/*
+ * Interleaved chunks cutting through tiles would hash a different partial
+ * tile every time and never match.
+ */
+BUILD_ASSERT((CONFIG_ST7735S_INTERLEAVE_ROWS % CONFIG_ST7735S_TILE_SIZE) == 0,
+	     "ST7735S_INTERLEAVE_ROWS must be a multiple of ST7735S_TILE_SIZE");
+
+/* Tiles per side of a square grid covering either orientation */
+#define ST7735S_TILE_STRIDE(inst)						\
+	DIV_ROUND_UP(MAX(DT_INST_PROP(inst, width),				\
+			 DT_INST_PROP(inst, height)), CONFIG_ST7735S_TILE_SIZE)
+#define ST7735S_TILE_MAX_SPANS							\
+	DIV_ROUND_UP(ST7735S_RAM_HEIGHT, CONFIG_ST7735S_TILE_SIZE)
+#endif
+
+/* Upper bound for mirror-displays, sizes the request array on the stack */
+#define ST7735S_MAX_MIRRORS 3
+
+/* Boot splash pixels decoded per SPI transfer */
+#define ST7735S_SPLASH_CHUNK 64u
+
+/* Internal oscillator and scan lines used by the FRMCTR1 frame rate formula */
+#define ST7735S_FOSC_HZ                 850000u
+#define ST7735S_FRAME_LINES             160u
+
+#ifdef CONFIG_ST7735S_RGB444
+BUILD_ASSERT((CONFIG_ST7735S_TX_BUF_SIZE % 3) == 0,
+	     "ST7735S_TX_BUF_SIZE must hold whole RGB444 pixel pairs");
+#endif
+
+#ifdef CONFIG_ST7735S_SWAP_RGB565
+BUILD_ASSERT((CONFIG_ST7735S_TX_BUF_SIZE % 8) == 0,
+	     "ST7735S_TX_BUF_SIZE must split into two word aligned halves");
+#define ST7735S_BOUNCE_SIZE (CONFIG_ST7735S_TX_BUF_SIZE / 2)
+#endif
+
 struct st7735s_config {
 	struct spi_dt_spec bus;
 	struct gpio_dt_spec cmd_data;
 	struct gpio_dt_spec reset;
+	struct gpio_dt_spec te;
 	uint16_t height;
 	uint16_t width;
+	uint16_t x_offset;
+	uint16_t y_offset;
 	uint8_t madctl;
 	uint8_t colmod;
-	uint8_t caset[4];
-	uint8_t raset[4];
-	uint8_t vmctr1;
-	uint8_t invctr;
-	uint8_t pwctr1[3];
-	uint8_t pwctr2[1];
-	uint8_t pwctr3[2];
-	uint8_t pwctr4[2];
-	uint8_t pwctr5[2];
 	uint8_t frmctr1[3];
-	uint8_t frmctr2[3];
-	uint8_t frmctr3[6];
-	uint8_t gamctrp1[16];
-	uint8_t gamctrn1[16];
+	/* Register setup as (command, parameter count, parameters...) */
+	const uint8_t *init_cmds;
+	size_t init_cmds_len;
+	/* GAMCTRP1 and GAMCTRN1 parameters back to back, alternate set or NULL */
+	const uint8_t *gamma;
+	const uint8_t *gamma_alt;
+#ifdef CONFIG_ST7735S_TILE_DIFF
+	/* Tile hash grid, tile_stride tiles per row */
+	size_t tile_count;
+	uint16_t tile_stride;
+#endif
+	/* Panels showing the same content, written along with this one */
+	const struct device *const *mirrors;
+	size_t mirror_count;
 	bool inversion_on;
 	bool rgb_is_inverted;
 };
@@ -58,6 +111,63 @@ struct st7735s_config {
 struct st7735s_data {
 	uint16_t x_offset;
 	uint16_t y_offset;
+	uint16_t width;
+	uint16_t height;
+	uint8_t madctl;
+	enum display_orientation orientation;
+	bool inverted;
+	bool gamma_alt;
+	/* Partial area rows, valid when partial_end >= partial_start */
+	uint16_t partial_start;
+	uint16_t partial_end;
+	bool partial;
+	bool idle;
+	k_timepoint_t cmd_ready;
+	k_timepoint_t sleep_in_ready;
+#if defined(CONFIG_ST7735S_RGB444) || defined(CONFIG_ST7735S_SWAP_RGB565)
+	uint8_t tx_buf[CONFIG_ST7735S_TX_BUF_SIZE] __aligned(4);
+#endif
+#ifdef CONFIG_ST7735S_SWAP_RGB565
+	/* Bounce buffer halves, in flight until st7735s_bounce_wait() */
+	struct spi_buf bounce[2];
+#ifdef CONFIG_SPI_ASYNC
+	struct k_poll_signal bounce_sig;
+	bool bounce_busy;
+#endif
+#endif
+#ifdef CONFIG_ST7735S_FRAME_SYNC
+	struct k_sem frame_sem;
+	struct gpio_callback te_cb;
+	uint32_t frame_period_us;
+	/* Without TE, one frame period after the last frame start */
+	k_timepoint_t next_frame;
+	/* Frames are closed by st7735s_frame_done() rather than each write */
+	bool frame_marked;
+	/* The current frame already waited for the panel frame start */
+	bool frame_open;
+#endif
+#if CONFIG_ST7735S_STATIC_TIMEOUT_MS > 0
+	/* Serializes writes with the static mode work */
+	struct k_mutex lock;
+	struct k_work_delayable static_work;
+	const struct device *dev;
+	bool static_partial;
+	bool static_idle;
+	/* Modes entered by the static timeout, left again on the next write */
+	bool entered_partial;
+	bool entered_idle;
+#endif
+#ifdef CONFIG_ST7735S_TILE_DIFF
+	uint32_t *tile_hash;
+#endif
+#if defined(CONFIG_ST7735S_PIXEL_DOUBLING) && !defined(CONFIG_ST7735S_SWAP_RGB565)
+	/* One full resolution row, a doubled pixel per word */
+	uint32_t dbl_row[DIV_ROUND_UP(ST7735S_RAM_HEIGHT, 2)];
+#endif
+#ifdef CONFIG_ST7735S_STATS
+	struct k_spinlock stats_lock;
+	struct st7735s_stats stats;
+#endif
 };
 
 static void st7735s_set_lcd_margins(const struct device *dev,
@@ -69,6 +179,103 @@ static void st7735s_set_lcd_margins(const struct device *dev,
 	data->y_offset = y_offset;
 }
 
+#ifdef CONFIG_ST7735S_STATS
+static void st7735s_stats_tx(const struct device *dev,
+			     const struct spi_buf_set *tx_bufs)
+{
+	struct st7735s_data *data = dev->data;
+	k_spinlock_key_t key = k_spin_lock(&data->stats_lock);
+
+	for (size_t i = 0; i < tx_bufs->count; i++) {
+		data->stats.bytes += tx_bufs->buffers[i].len;
+	}
+	data->stats.transactions++;
+
+	k_spin_unlock(&data->stats_lock, key);
+}
+
+static void st7735s_stats_window(const struct device *dev)
+{
+	struct st7735s_data *data = dev->data;
+	k_spinlock_key_t key = k_spin_lock(&data->stats_lock);
+
+	data->stats.windows++;
+
+	k_spin_unlock(&data->stats_lock, key);
+}
+
+static void st7735s_stats_write(const struct device *dev, uint32_t cycles)
+{
+	struct st7735s_data *data = dev->data;
+	uint32_t us = k_cyc_to_us_ceil32(cycles);
+	size_t bucket = 0;
+	k_spinlock_key_t key;
+
+	/* Bucket n holds latencies below 2^n ms, the last one the rest */
+	while (bucket < ST7735S_STATS_HIST_BUCKETS - 1 &&
+	       us >= (USEC_PER_MSEC << bucket)) {
+		bucket++;
+	}
+
+	key = k_spin_lock(&data->stats_lock);
+
+	if (data->stats.writes == 0 || us < data->stats.latency_min_us) {
+		data->stats.latency_min_us = us;
+	}
+	if (us > data->stats.latency_max_us) {
+		data->stats.latency_max_us = us;
+	}
+	data->stats.latency_sum_us += us;
+	data->stats.latency_hist[bucket]++;
+	data->stats.writes++;
+
+	k_spin_unlock(&data->stats_lock, key);
+}
+#endif /* CONFIG_ST7735S_STATS */
+
+int st7735s_get_stats(const struct device *dev, struct st7735s_stats *stats)
+{
+#ifdef CONFIG_ST7735S_STATS
+	struct st7735s_data *data = dev->data;
+	k_spinlock_key_t key = k_spin_lock(&data->stats_lock);
+
+	*stats = data->stats;
+
+	k_spin_unlock(&data->stats_lock, key);
+
+	return 0;
+#else
+	return -ENOTSUP;
+#endif
+}
+
+int st7735s_reset_stats(const struct device *dev)
+{
+#ifdef CONFIG_ST7735S_STATS
+	struct st7735s_data *data = dev->data;
+	k_spinlock_key_t key = k_spin_lock(&data->stats_lock);
+
+	memset(&data->stats, 0, sizeof(data->stats));
+
+	k_spin_unlock(&data->stats_lock, key);
+
+	return 0;
+#else
+	return -ENOTSUP;
+#endif
+}
+
+static int st7735s_spi_write(const struct device *dev,
+			     const struct spi_dt_spec *bus,
+			     const struct spi_buf_set *tx_bufs)
+{
+#ifdef CONFIG_ST7735S_STATS
+	st7735s_stats_tx(dev, tx_bufs);
+#endif
+
+	return spi_write_dt(bus, tx_bufs);
+}
+
 static void st7735s_set_cmd(const struct device *dev, int is_cmd)
 {
 	const struct st7735s_config *config = dev->config;
@@ -76,16 +283,27 @@ static void st7735s_set_cmd(const struct device *dev, int is_cmd)
 	gpio_pin_set_dt(&config->cmd_data, is_cmd);
 }
 
-static int st7735s_transmit(const struct device *dev, uint8_t cmd,
-			    const uint8_t *tx_data, size_t tx_count)
+static void st7735s_wait_ready(const struct device *dev)
+{
+	struct st7735s_data *data = dev->data;
+
+	if (!sys_timepoint_expired(data->cmd_ready)) {
+		k_sleep(sys_timepoint_timeout(data->cmd_ready));
+	}
+}
+
+static int st7735s_transmit_bus(const struct device *dev,
+				const struct spi_dt_spec *bus, uint8_t cmd,
+				const uint8_t *tx_data, size_t tx_count)
 {
-	const struct st7735s_config *config = dev->config;
 	struct spi_buf tx_buf = { .buf = &cmd, .len = 1 };
 	struct spi_buf_set tx_bufs = { .buffers = &tx_buf, .count = 1 };
 	int ret;
 
+	st7735s_wait_ready(dev);
+
 	st7735s_set_cmd(dev, 1);
-	ret = spi_write_dt(&config->bus, &tx_bufs);
+	ret = st7735s_spi_write(dev, bus, &tx_bufs);
 	if (ret < 0) {
 		return ret;
 	}
@@ -94,7 +312,7 @@ static int st7735s_transmit(const struct device *dev, uint8_t cmd,
 		tx_buf.buf = (void *)tx_data;
 		tx_buf.len = tx_count;
 		st7735s_set_cmd(dev, 0);
-		ret = spi_write_dt(&config->bus, &tx_bufs);
+		ret = st7735s_spi_write(dev, bus, &tx_bufs);
 		if (ret < 0) {
 			return ret;
 		}
@@ -103,8 +321,197 @@ static int st7735s_transmit(const struct device *dev, uint8_t cmd,
 	return 0;
 }
 
+static int st7735s_transmit(const struct device *dev, uint8_t cmd,
+			    const uint8_t *tx_data, size_t tx_count)
+{
+	const struct st7735s_config *config = dev->config;
+
+	return st7735s_transmit_bus(dev, &config->bus, cmd, tx_data, tx_count);
+}
+
+/*
+ * Send a (command, parameter count, parameters...) table. Chip select and
+ * the bus stay with the panel between the individual transfers, so only
+ * the D/C line changes. They are handed back while the controller is not
+ * ready for the next command, other devices on the bus are not held up
+ * by the sleep out delay.
+ */
+static int st7735s_transmit_table(const struct device *dev,
+				  const uint8_t *table, size_t len)
+{
+	const struct st7735s_config *config = dev->config;
+	struct st7735s_data *data = dev->data;
+	struct spi_dt_spec bus = config->bus;
+	size_t i = 0;
+	int ret = 0;
+
+	bus.config.operation |= SPI_HOLD_ON_CS | SPI_LOCK_ON;
+
+	while (i + 1 < len) {
+		uint8_t cmd = table[i];
+		uint8_t count = table[i + 1];
+
+		if (!sys_timepoint_expired(data->cmd_ready)) {
+			spi_release_dt(&bus);
+			st7735s_wait_ready(dev);
+		}
+
+		ret = st7735s_transmit_bus(dev, &bus, cmd,
+					   count ? &table[i + 2] : NULL, count);
+		if (ret < 0) {
+			break;
+		}
+
+		i += 2 + count;
+	}
+
+	spi_release_dt(&bus);
+
+	return ret;
+}
+
+#ifdef CONFIG_ST7735S_FRAME_SYNC
+static void st7735s_te_handler(const struct device *port,
+			       struct gpio_callback *cb, gpio_port_pins_t pins)
+{
+	struct st7735s_data *data = CONTAINER_OF(cb, struct st7735s_data, te_cb);
+
+	k_sem_give(&data->frame_sem);
+}
+
+/*
+ * Frame period in normal mode, from the FRMCTR1 RTNA/FPA/BPA values:
+ * fosc / ((RTNA * 2 + 40) * (LINE + FPA + BPA + 2)).
+ */
+static uint32_t st7735s_frame_period_us(const struct st7735s_config *config)
+{
+	uint32_t rtna = config->frmctr1[0] & 0x0f;
+	uint32_t fpa = config->frmctr1[1] & 0x3f;
+	uint32_t bpa = config->frmctr1[2] & 0x3f;
+	uint64_t clocks = (rtna * 2 + 40) * (ST7735S_FRAME_LINES + fpa + bpa + 2);
+
+	return (uint32_t)((clocks * USEC_PER_SEC) / ST7735S_FOSC_HZ);
+}
+
+static void st7735s_wait_frame(const struct device *dev)
+{
+	const struct st7735s_config *config = dev->config;
+	struct st7735s_data *data = dev->data;
+
+	/*
+	 * Without a TE line there is no scan position to lock onto, frames
+	 * are paced to the FRMCTR1 period instead.
+	 */
+	if (config->te.port == NULL) {
+		if (!sys_timepoint_expired(data->next_frame)) {
+			k_sleep(sys_timepoint_timeout(data->next_frame));
+		}
+		data->next_frame =
+			sys_timepoint_calc(K_USEC(data->frame_period_us));
+		return;
+	}
+
+	/*
+	 * The edge interrupt is only armed while a write waits for it, an
+	 * idle display does not wake the CPU every frame.
+	 */
+	k_sem_reset(&data->frame_sem);
+	if (gpio_pin_interrupt_configure_dt(&config->te,
+					    GPIO_INT_EDGE_TO_ACTIVE) < 0) {
+		return;
+	}
+
+	if (k_sem_take(&data->frame_sem,
+		       K_USEC(2 * data->frame_period_us)) < 0) {
+		LOG_DBG("No frame start within two frame periods");
+	}
+
+	(void)gpio_pin_interrupt_configure_dt(&config->te, GPIO_INT_DISABLE);
+}
+
+/*
+ * Wait for the frame start once per frame: before every write, or only
+ * before the first one after st7735s_frame_done() once that is in use.
+ */
+static void st7735s_sync_frame(const struct device *dev)
+{
+	struct st7735s_data *data = dev->data;
+
+	if (data->frame_open) {
+		return;
+	}
+
+	st7735s_wait_frame(dev);
+	data->frame_open = data->frame_marked;
+}
+
+static int st7735s_frame_sync_init(const struct device *dev)
+{
+	const struct st7735s_config *config = dev->config;
+	struct st7735s_data *data = dev->data;
+	int ret;
+
+	data->frame_period_us = st7735s_frame_period_us(config);
+	data->next_frame = sys_timepoint_calc(K_NO_WAIT);
+	k_sem_init(&data->frame_sem, 0, 1);
+
+	if (config->te.port == NULL) {
+		LOG_DBG("No TE line, frames paced every %u us",
+			data->frame_period_us);
+		return 0;
+	}
+
+	if (!gpio_is_ready_dt(&config->te)) {
+		LOG_ERR("TE GPIO port for display not ready");
+		return -ENODEV;
+	}
+
+	ret = gpio_pin_configure_dt(&config->te, GPIO_INPUT);
+	if (ret < 0) {
+		LOG_ERR("Couldn't configure TE pin");
+		return ret;
+	}
+
+	gpio_init_callback(&data->te_cb, st7735s_te_handler,
+			   BIT(config->te.pin));
+	ret = gpio_add_callback(config->te.port, &data->te_cb);
+	if (ret < 0) {
+		return ret;
+	}
+
+	/* Armed by st7735s_wait_frame() only */
+	ret = gpio_pin_interrupt_configure_dt(&config->te, GPIO_INT_DISABLE);
+	if (ret < 0) {
+		LOG_ERR("Couldn't configure TE interrupt");
+		return ret;
+	}
+
+	return 0;
+}
+#endif /* CONFIG_ST7735S_FRAME_SYNC */
+
+int st7735s_frame_done(const struct device *dev)
+{
+#ifdef CONFIG_ST7735S_FRAME_SYNC
+	struct st7735s_data *data = dev->data;
+
+	data->frame_marked = true;
+	data->frame_open = false;
+
+	return 0;
+#else
+	return -ENOTSUP;
+#endif
+}
+
+/*
+ * Leave sleep without blocking: the next command is held back until the
+ * controller accepts commands again, SLEEP_IN until the full sleep out
+ * sequence has passed.
+ */
 static int st7735s_exit_sleep(const struct device *dev)
 {
+	struct st7735s_data *data = dev->data;
 	int ret;
 
 	ret = st7735s_transmit(dev, ST7735S_CMD_SLEEP_OUT, NULL, 0);
@@ -112,79 +519,1215 @@ static int st7735s_exit_sleep(const struct device *dev)
 		return ret;
 	}
 
-	k_sleep(ST7735S_EXIT_SLEEP_TIME);
+	data->cmd_ready = sys_timepoint_calc(ST7735S_SLEEP_OUT_CMD_DELAY);
+	data->sleep_in_ready =
+		sys_timepoint_calc(ST7735S_SLEEP_OUT_SLEEP_IN_DELAY);
 
 	return 0;
 }
 
+static int st7735s_enter_sleep(const struct device *dev)
+{
+	struct st7735s_data *data = dev->data;
+
+	if (!sys_timepoint_expired(data->sleep_in_ready)) {
+		k_sleep(sys_timepoint_timeout(data->sleep_in_ready));
+	}
+
+	return st7735s_transmit(dev, ST7735S_CMD_SLEEP_IN, NULL, 0);
+}
+
 static int st7735s_reset_display(const struct device *dev)
+{
+	const struct st7735s_config *config = dev->config;
+	struct st7735s_data *data = dev->data;
+	int ret;
+
+	LOG_DBG("Resetting display");
+	if (config->reset.port != NULL) {
+		gpio_pin_set_dt(&config->reset, 1);
+		k_sleep(ST7735S_RESET_TIME);
+		gpio_pin_set_dt(&config->reset, 0);
+	} else {
+		ret = st7735s_transmit(dev, ST7735S_CMD_SW_RESET, NULL, 0);
+		if (ret < 0) {
+			return ret;
+		}
+	}
+
+	/* SLEEP_OUT is held back by st7735s_transmit() until reset is done */
+	data->cmd_ready = sys_timepoint_calc(ST7735S_EXIT_SLEEP_TIME);
+
+	return 0;
+}
+
+/* Send a parameterless command to the panel and the panels mirroring it */
+static int st7735s_transmit_all(const struct device *dev, uint8_t cmd)
+{
+	const struct st7735s_config *config = dev->config;
+	int ret;
+
+	ret = st7735s_transmit(dev, cmd, NULL, 0);
+
+	for (size_t i = 0; i < config->mirror_count && ret == 0; i++) {
+		ret = st7735s_transmit(config->mirrors[i], cmd, NULL, 0);
+	}
+
+	return ret;
+}
+
+static int st7735s_blanking_on(const struct device *dev)
+{
+	return st7735s_transmit_all(dev, ST7735S_CMD_DISP_OFF);
+}
+
+static int st7735s_blanking_off(const struct device *dev)
+{
+	return st7735s_transmit_all(dev, ST7735S_CMD_DISP_ON);
+}
+
+static void st7735s_lock(const struct device *dev)
+{
+#if CONFIG_ST7735S_STATIC_TIMEOUT_MS > 0
+	struct st7735s_data *data = dev->data;
+
+	k_mutex_lock(&data->lock, K_FOREVER);
+#endif
+}
+
+static void st7735s_unlock(const struct device *dev)
+{
+#if CONFIG_ST7735S_STATIC_TIMEOUT_MS > 0
+	struct st7735s_data *data = dev->data;
+
+	k_mutex_unlock(&data->lock);
+#endif
+}
+
+static int st7735s_send_inversion(const struct device *dev)
+{
+	const struct st7735s_config *config = dev->config;
+	struct st7735s_data *data = dev->data;
+
+	return st7735s_transmit(dev, (config->inversion_on != data->inverted) ?
+				ST7735S_CMD_INV_ON : ST7735S_CMD_INV_OFF, NULL, 0);
+}
+
+static int st7735s_send_gamma(const struct device *dev)
+{
+	const struct st7735s_config *config = dev->config;
+	struct st7735s_data *data = dev->data;
+	const uint8_t *gamma = data->gamma_alt ? config->gamma_alt : config->gamma;
+	int ret;
+
+	ret = st7735s_transmit(dev, ST7735S_CMD_GAMCTRP1, gamma,
+			       ST7735S_GAMMA_SIZE);
+	if (ret < 0) {
+		return ret;
+	}
+
+	return st7735s_transmit(dev, ST7735S_CMD_GAMCTRN1,
+				gamma + ST7735S_GAMMA_SIZE, ST7735S_GAMMA_SIZE);
+}
+
+static int st7735s_invert_panel(const struct device *dev, bool invert)
+{
+	struct st7735s_data *data = dev->data;
+	int ret = 0;
+
+	st7735s_lock(dev);
+
+	if (data->inverted != invert) {
+		data->inverted = invert;
+		ret = st7735s_send_inversion(dev);
+	}
+
+	st7735s_unlock(dev);
+
+	return ret;
+}
+
+/* Mirror panels invert along, relative to their own inversion-on */
+int st7735s_set_inversion(const struct device *dev, bool invert)
 {
 	const struct st7735s_config *config = dev->config;
 	int ret;
 
-	LOG_DBG("Resetting display");
-	if (config->reset.port != NULL) {
-		gpio_pin_set_dt(&config->reset, 1);
-		k_sleep(ST7735S_RESET_TIME);
-		gpio_pin_set_dt(&config->reset, 0);
-	} else {
-		ret = st7735s_transmit(dev, ST7735S_CMD_SW_RESET, NULL, 0);
-		if (ret < 0) {
-			return ret;
+	ret = st7735s_invert_panel(dev, invert);
+
+	for (size_t i = 0; i < config->mirror_count && ret == 0; i++) {
+		ret = st7735s_invert_panel(config->mirrors[i], invert);
+	}
+
+	return ret;
+}
+
+static int st7735s_gamma_panel(const struct device *dev, bool alternate)
+{
+	struct st7735s_data *data = dev->data;
+	int ret = 0;
+
+	st7735s_lock(dev);
+
+	if (data->gamma_alt != alternate) {
+		data->gamma_alt = alternate;
+		ret = st7735s_send_gamma(dev);
+	}
+
+	st7735s_unlock(dev);
+
+	return ret;
+}
+
+static bool st7735s_has_gamma_alt(const struct device *dev)
+{
+	const struct st7735s_config *config = dev->config;
+
+	return config->gamma_alt != NULL;
+}
+
+/* Mirror panels switch to their own alternate curves */
+int st7735s_set_gamma(const struct device *dev, bool alternate)
+{
+	const struct st7735s_config *config = dev->config;
+	int ret;
+
+	if (alternate) {
+		if (!st7735s_has_gamma_alt(dev)) {
+			return -ENOTSUP;
+		}
+		for (size_t i = 0; i < config->mirror_count; i++) {
+			if (!st7735s_has_gamma_alt(config->mirrors[i])) {
+				return -ENOTSUP;
+			}
+		}
+	}
+
+	ret = st7735s_gamma_panel(dev, alternate);
+
+	for (size_t i = 0; i < config->mirror_count && ret == 0; i++) {
+		ret = st7735s_gamma_panel(config->mirrors[i], alternate);
+	}
+
+	return ret;
+}
+
+static inline bool st7735s_has_partial_area(const struct st7735s_data *data)
+{
+	return data->partial_end >= data->partial_start;
+}
+
+static int st7735s_send_partial_area(const struct device *dev)
+{
+	struct st7735s_data *data = dev->data;
+	uint16_t rows[2];
+
+	rows[0] = sys_cpu_to_be16(data->partial_start);
+	rows[1] = sys_cpu_to_be16(data->partial_end);
+
+	return st7735s_transmit(dev, ST7735S_CMD_PTLAR, (uint8_t *)rows,
+				sizeof(rows));
+}
+
+static int st7735s_send_scan_mode(const struct device *dev, bool partial)
+{
+	return st7735s_transmit(dev, partial ? ST7735S_CMD_PTLON :
+				ST7735S_CMD_NORON, NULL, 0);
+}
+
+static int st7735s_send_idle(const struct device *dev, bool idle)
+{
+	return st7735s_transmit(dev, idle ? ST7735S_CMD_IDMON :
+				ST7735S_CMD_IDMOFF, NULL, 0);
+}
+
+static int st7735s_partial_area_panel(const struct device *dev,
+				      uint16_t start_row, uint16_t end_row)
+{
+	struct st7735s_data *data = dev->data;
+	int ret = 0;
+
+	st7735s_lock(dev);
+
+	data->partial_start = start_row;
+	data->partial_end = end_row;
+	ret = st7735s_send_partial_area(dev);
+
+	st7735s_unlock(dev);
+
+	return ret;
+}
+
+int st7735s_set_partial_area(const struct device *dev, uint16_t start_row,
+			     uint16_t end_row)
+{
+	const struct st7735s_config *config = dev->config;
+	int ret;
+
+	if (start_row > end_row || end_row >= ST7735S_RAM_HEIGHT) {
+		return -EINVAL;
+	}
+
+	ret = st7735s_partial_area_panel(dev, start_row, end_row);
+
+	for (size_t i = 0; i < config->mirror_count && ret == 0; i++) {
+		ret = st7735s_partial_area_panel(config->mirrors[i], start_row,
+						 end_row);
+	}
+
+	return ret;
+}
+
+static int st7735s_partial_mode_panel(const struct device *dev, bool enable)
+{
+	struct st7735s_data *data = dev->data;
+	int ret = 0;
+
+	st7735s_lock(dev);
+
+	if (data->partial != enable) {
+		ret = st7735s_send_scan_mode(dev, enable);
+		if (ret == 0) {
+			data->partial = enable;
+		}
+	}
+#if CONFIG_ST7735S_STATIC_TIMEOUT_MS > 0
+	/* Explicitly requested, keep it across writes */
+	data->entered_partial = false;
+#endif
+
+	st7735s_unlock(dev);
+
+	return ret;
+}
+
+int st7735s_set_partial_mode(const struct device *dev, bool enable)
+{
+	const struct st7735s_config *config = dev->config;
+	int ret;
+
+	if (enable) {
+		if (!st7735s_has_partial_area(dev->data)) {
+			return -EINVAL;
+		}
+		for (size_t i = 0; i < config->mirror_count; i++) {
+			if (!st7735s_has_partial_area(config->mirrors[i]->data)) {
+				return -EINVAL;
+			}
+		}
+	}
+
+	ret = st7735s_partial_mode_panel(dev, enable);
+
+	for (size_t i = 0; i < config->mirror_count && ret == 0; i++) {
+		ret = st7735s_partial_mode_panel(config->mirrors[i], enable);
+	}
+
+	return ret;
+}
+
+static int st7735s_idle_mode_panel(const struct device *dev, bool enable)
+{
+	struct st7735s_data *data = dev->data;
+	int ret = 0;
+
+	st7735s_lock(dev);
+
+	if (data->idle != enable) {
+		ret = st7735s_send_idle(dev, enable);
+		if (ret == 0) {
+			data->idle = enable;
+		}
+	}
+#if CONFIG_ST7735S_STATIC_TIMEOUT_MS > 0
+	data->entered_idle = false;
+#endif
+
+	st7735s_unlock(dev);
+
+	return ret;
+}
+
+int st7735s_set_idle_mode(const struct device *dev, bool enable)
+{
+	const struct st7735s_config *config = dev->config;
+	int ret;
+
+	ret = st7735s_idle_mode_panel(dev, enable);
+
+	for (size_t i = 0; i < config->mirror_count && ret == 0; i++) {
+		ret = st7735s_idle_mode_panel(config->mirrors[i], enable);
+	}
+
+	return ret;
+}
+
+#if CONFIG_ST7735S_STATIC_TIMEOUT_MS > 0
+static void st7735s_static_work_handler(struct k_work *work)
+{
+	struct k_work_delayable *dwork = k_work_delayable_from_work(work);
+	struct st7735s_data *data =
+		CONTAINER_OF(dwork, struct st7735s_data, static_work);
+	const struct device *dev = data->dev;
+
+	st7735s_lock(dev);
+
+	if (data->static_partial && !data->partial &&
+	    st7735s_has_partial_area(data) &&
+	    st7735s_send_scan_mode(dev, true) == 0) {
+		data->partial = true;
+		data->entered_partial = true;
+	}
+
+	if (data->static_idle && !data->idle &&
+	    st7735s_send_idle(dev, true) == 0) {
+		data->idle = true;
+		data->entered_idle = true;
+	}
+
+	st7735s_unlock(dev);
+
+	LOG_DBG("Static display, partial %d idle %d", data->entered_partial,
+		data->entered_idle);
+}
+
+/* Leave the modes the static timeout entered, caller holds the lock */
+static int st7735s_leave_static(const struct device *dev)
+{
+	struct st7735s_data *data = dev->data;
+	int ret;
+
+	if (data->entered_idle) {
+		ret = st7735s_send_idle(dev, false);
+		if (ret < 0) {
+			return ret;
+		}
+		data->idle = false;
+		data->entered_idle = false;
+	}
+
+	if (data->entered_partial) {
+		ret = st7735s_send_scan_mode(dev, false);
+		if (ret < 0) {
+			return ret;
+		}
+		data->partial = false;
+		data->entered_partial = false;
+	}
+
+	return 0;
+}
+#endif /* CONFIG_ST7735S_STATIC_TIMEOUT_MS > 0 */
+
+#if CONFIG_ST7735S_STATIC_TIMEOUT_MS > 0
+static void st7735s_static_modes_panel(const struct device *dev, bool partial,
+				       bool idle)
+{
+	struct st7735s_data *data = dev->data;
+
+	st7735s_lock(dev);
+	data->static_partial = partial;
+	data->static_idle = idle;
+	st7735s_unlock(dev);
+
+	k_work_reschedule(&data->static_work,
+			  K_MSEC(CONFIG_ST7735S_STATIC_TIMEOUT_MS));
+}
+#endif
+
+/* Mirror panels get every write too, each times out on its own */
+int st7735s_set_static_modes(const struct device *dev, bool partial, bool idle)
+{
+#if CONFIG_ST7735S_STATIC_TIMEOUT_MS > 0
+	const struct st7735s_config *config = dev->config;
+
+	st7735s_static_modes_panel(dev, partial, idle);
+
+	for (size_t i = 0; i < config->mirror_count; i++) {
+		st7735s_static_modes_panel(config->mirrors[i], partial, idle);
+	}
+
+	return 0;
+#else
+	return -ENOTSUP;
+#endif
+}
+
+static int st7735s_read(const struct device *dev,
+			const uint16_t x,
+			const uint16_t y,
+			const struct display_buffer_descriptor *desc,
+			void *buf)
+{
+	return -ENOTSUP;
+}
+
+static int st7735s_set_mem_area(const struct device *dev,
+				const uint16_t x, const uint16_t y,
+				const uint16_t w, const uint16_t h)
+{
+	struct st7735s_data *data = dev->data;
+	uint16_t spi_data[2];
+
+	int ret;
+
+	uint16_t ram_x = x + data->x_offset;
+	uint16_t ram_y = y + data->y_offset;
+
+	spi_data[0] = sys_cpu_to_be16(ram_x);
+	spi_data[1] = sys_cpu_to_be16(ram_x + w - 1);
+	ret = st7735s_transmit(dev, ST7735S_CMD_CASET, (uint8_t *)&spi_data[0], 4);
+	if (ret < 0) {
+		return ret;
+	}
+
+	spi_data[0] = sys_cpu_to_be16(ram_y);
+	spi_data[1] = sys_cpu_to_be16(ram_y + h - 1);
+	ret = st7735s_transmit(dev, ST7735S_CMD_RASET, (uint8_t *)&spi_data[0], 4);
+	if (ret < 0) {
+		return ret;
+	}
+
+#ifdef CONFIG_ST7735S_STATS
+	st7735s_stats_window(dev);
+#endif
+
+	return 0;
+}
+
+static inline bool st7735s_is_rgb444(const struct device *dev)
+{
+	const struct st7735s_config *config = dev->config;
+
+	return (config->colmod & ST7735S_COLMOD_IFPF_MASK) ==
+	       ST7735S_COLMOD_12BIT;
+}
+
+#if defined(CONFIG_ST7735S_RGB444) || defined(CONFIG_ST7735S_SWAP_RGB565)
+/* Source pixel as handed over by the display API */
+static inline uint16_t st7735s_get_rgb565(const uint8_t *px)
+{
+	if (IS_ENABLED(CONFIG_ST7735S_SWAP_RGB565)) {
+		return UNALIGNED_GET((const uint16_t *)px);
+	}
+
+	return sys_get_be16(px);
+}
+#endif
+
+#ifdef CONFIG_ST7735S_SWAP_RGB565
+/* Swap the bytes of both halfwords, a single REV16 on Cortex-M */
+static inline uint32_t st7735s_rev16(uint32_t v)
+{
+#ifdef CONFIG_CPU_CORTEX_M
+	return __REV16(v);
+#else
+	return ((v & 0x00ff00ffu) << 8) | ((v >> 8) & 0x00ff00ffu);
+#endif
+}
+
+static void st7735s_swap_rgb565(uint8_t *dst, const uint8_t *src, size_t len)
+{
+	for (; len >= 4; len -= 4) {
+		UNALIGNED_PUT(st7735s_rev16(UNALIGNED_GET((const uint32_t *)src)),
+			      (uint32_t *)dst);
+		src += 4;
+		dst += 4;
+	}
+
+	if (len != 0) {
+		dst[0] = src[1];
+		dst[1] = src[0];
+	}
+}
+
+#ifdef CONFIG_ST7735S_PIXEL_DOUBLING
+/* Swap and repeat every pixel, the row half of 2x2 pixel doubling */
+static void st7735s_swap_double_rgb565(uint8_t *dst, const uint8_t *src,
+				       size_t len)
+{
+	for (; len >= ST7735S_PIXEL_SIZE; len -= ST7735S_PIXEL_SIZE) {
+		uint32_t c = BSWAP_16(UNALIGNED_GET((const uint16_t *)src));
+
+		/* Same two bytes twice, whatever the CPU byte order */
+		UNALIGNED_PUT((c << 16) | c, (uint32_t *)dst);
+		src += ST7735S_PIXEL_SIZE;
+		dst += 2 * ST7735S_PIXEL_SIZE;
+	}
+}
+#endif
+
+static int st7735s_bounce_wait(const struct device *dev)
+{
+#ifdef CONFIG_SPI_ASYNC
+	struct st7735s_data *data = dev->data;
+	struct k_poll_event evt = K_POLL_EVENT_INITIALIZER(
+		K_POLL_TYPE_SIGNAL, K_POLL_MODE_NOTIFY_ONLY, &data->bounce_sig);
+	unsigned int signaled;
+	int result;
+
+	if (!data->bounce_busy) {
+		return 0;
+	}
+
+	k_poll(&evt, 1, K_FOREVER);
+	k_poll_signal_check(&data->bounce_sig, &signaled, &result);
+	k_poll_signal_reset(&data->bounce_sig);
+	data->bounce_busy = false;
+
+	return result;
+#else
+	ARG_UNUSED(dev);
+
+	return 0;
+#endif
+}
+
+/*
+ * Send one bounce buffer half. With SPI_ASYNC the transfer is only started,
+ * the caller converts into the other half meanwhile.
+ */
+static int st7735s_bounce_send(const struct device *dev, int idx, size_t len)
+{
+	const struct st7735s_config *config = dev->config;
+	struct st7735s_data *data = dev->data;
+	struct spi_buf_set tx_bufs = { .buffers = &data->bounce[idx], .count = 1 };
+	int ret;
+
+	ret = st7735s_bounce_wait(dev);
+	if (ret < 0) {
+		return ret;
+	}
+
+	data->bounce[idx].buf = data->tx_buf + idx * ST7735S_BOUNCE_SIZE;
+	data->bounce[idx].len = len;
+
+#ifdef CONFIG_ST7735S_STATS
+	st7735s_stats_tx(dev, &tx_bufs);
+#endif
+
+#ifdef CONFIG_SPI_ASYNC
+	ret = spi_transceive_signal(config->bus.bus, &config->bus.config,
+				    &tx_bufs, NULL, &data->bounce_sig);
+	if (ret == 0) {
+		data->bounce_busy = true;
+		return 0;
+	}
+
+	if (ret != -ENOTSUP) {
+		return ret;
+	}
+#endif
+
+	return spi_write_dt(&config->bus, &tx_bufs);
+}
+
+/*
+ * Stream a window of native endian RGB565 pixels. Pixels are byte swapped
+ * into one half of the bounce buffer while the other half is on the bus.
+ * With a @p scale of 2 every pixel and every row is sent twice, for 2x2
+ * pixel doubling.
+ */
+static int st7735s_write_swapped(const struct device *dev,
+				 const struct display_buffer_descriptor *desc,
+				 const uint8_t *src, uint16_t scale)
+{
+	struct st7735s_data *data = dev->data;
+	size_t row_len = desc->width * ST7735S_PIXEL_SIZE;
+	size_t fill = 0;
+	int idx = 0;
+	int ret;
+
+	ret = st7735s_transmit(dev, ST7735S_CMD_RAMWR, NULL, 0);
+	if (ret < 0) {
+		return ret;
+	}
+
+	st7735s_set_cmd(dev, 0);
+
+	for (uint16_t row = 0; row < desc->height * scale; row++) {
+		const uint8_t *px = src + (row / scale) * desc->pitch *
+				    ST7735S_PIXEL_SIZE;
+		size_t left = row_len;
+
+		while (left != 0) {
+			/* Source bytes, scale times that many go out */
+			size_t n = MIN(left, (ST7735S_BOUNCE_SIZE - fill) / scale);
+			uint8_t *dst = data->tx_buf + idx * ST7735S_BOUNCE_SIZE +
+				       fill;
+
+#ifdef CONFIG_ST7735S_PIXEL_DOUBLING
+			if (scale == 2) {
+				st7735s_swap_double_rgb565(dst, px, n);
+			} else
+#endif
+			{
+				st7735s_swap_rgb565(dst, px, n);
+			}
+			fill += n * scale;
+			px += n;
+			left -= n;
+
+			if (fill == ST7735S_BOUNCE_SIZE) {
+				ret = st7735s_bounce_send(dev, idx, fill);
+				if (ret < 0) {
+					goto out;
+				}
+				idx ^= 1;
+				fill = 0;
+			}
+		}
+	}
+
+	if (fill != 0) {
+		ret = st7735s_bounce_send(dev, idx, fill);
+	}
+
+out:
+	if (ret < 0) {
+		(void)st7735s_bounce_wait(dev);
+		return ret;
+	}
+
+	return st7735s_bounce_wait(dev);
+}
+#endif /* CONFIG_ST7735S_SWAP_RGB565 */
+
+#ifdef CONFIG_ST7735S_RGB444
+static inline uint16_t st7735s_rgb565_to_444(const uint8_t *px)
+{
+	uint16_t rgb = st7735s_get_rgb565(px);
+
+	return ((rgb >> 4) & 0xf00) | ((rgb >> 3) & 0x0f0) |
+	       ((rgb >> 1) & 0x00f);
+}
+
+static int st7735s_tx_flush(const struct device *dev, size_t len)
+{
+	const struct st7735s_config *config = dev->config;
+	struct st7735s_data *data = dev->data;
+	struct spi_buf tx_buf = { .buf = data->tx_buf, .len = len };
+	struct spi_buf_set tx_bufs = { .buffers = &tx_buf, .count = 1 };
+
+	if (len == 0) {
+		return 0;
+	}
+
+	return st7735s_spi_write(dev, &config->bus, &tx_bufs);
+}
+
+static inline int st7735s_put_rgb444(const struct device *dev, uint8_t **dst,
+				     uint16_t c0, uint16_t c1)
+{
+	struct st7735s_data *data = dev->data;
+	uint8_t *p = *dst;
+	int ret;
+
+	if (p == data->tx_buf + sizeof(data->tx_buf)) {
+		ret = st7735s_tx_flush(dev, sizeof(data->tx_buf));
+		if (ret < 0) {
+			return ret;
+		}
+		p = data->tx_buf;
+	}
+
+	p[0] = c0 >> 4;
+	p[1] = ((c0 & 0x0f) << 4) | (c1 >> 8);
+	p[2] = c1;
+	*dst = p + 3;
+
+	return 0;
+}
+
+/*
+ * Stream a window as 12-bit pixels: every two RGB565 input pixels become
+ * three bytes (R1G1 B1R2 G2B2). Pairs may straddle rows, an odd pixel at
+ * the very end is padded with a nibble the controller ignores.
+ */
+static int st7735s_write_rgb444(const struct device *dev,
+				const struct display_buffer_descriptor *desc,
+				const uint8_t *src)
+{
+	struct st7735s_data *data = dev->data;
+	uint8_t *dst = data->tx_buf;
+	uint16_t carry = 0;
+	bool has_carry = false;
+	int ret;
+
+	ret = st7735s_transmit(dev, ST7735S_CMD_RAMWR, NULL, 0);
+	if (ret < 0) {
+		return ret;
+	}
+
+	st7735s_set_cmd(dev, 0);
+
+	for (uint16_t row = 0; row < desc->height; row++) {
+		const uint8_t *px = src + row * desc->pitch * ST7735S_PIXEL_SIZE;
+		uint16_t count = desc->width;
+
+		if (has_carry) {
+			ret = st7735s_put_rgb444(dev, &dst, carry,
+						 st7735s_rgb565_to_444(px));
+			if (ret < 0) {
+				return ret;
+			}
+			px += ST7735S_PIXEL_SIZE;
+			count--;
+			has_carry = false;
+		}
+
+		for (; count >= 2; count -= 2) {
+			ret = st7735s_put_rgb444(dev, &dst,
+				st7735s_rgb565_to_444(px),
+				st7735s_rgb565_to_444(px + ST7735S_PIXEL_SIZE));
+			if (ret < 0) {
+				return ret;
+			}
+			px += 2 * ST7735S_PIXEL_SIZE;
+		}
+
+		if (count != 0) {
+			carry = st7735s_rgb565_to_444(px);
+			has_carry = true;
+		}
+	}
+
+	if (has_carry) {
+		/* Trailing pixel, the second half of the pair is padding */
+		ret = st7735s_put_rgb444(dev, &dst, carry, 0);
+		if (ret < 0) {
+			return ret;
+		}
+		dst--;
+	}
+
+	return st7735s_tx_flush(dev, dst - data->tx_buf);
+}
+#endif /* CONFIG_ST7735S_RGB444 */
+
+#if defined(CONFIG_ST7735S_PIXEL_DOUBLING) && !defined(CONFIG_ST7735S_SWAP_RGB565)
+/*
+ * Stream a half resolution window at full size: every pixel is repeated
+ * once within its row, and every doubled row is sent twice by pointing
+ * both buffers of one transfer at it. Native endian input doubles through
+ * st7735s_write_swapped() instead.
+ */
+static int st7735s_write_doubled(const struct device *dev,
+				 const struct display_buffer_descriptor *desc,
+				 const uint8_t *src)
+{
+	const struct st7735s_config *config = dev->config;
+	struct st7735s_data *data = dev->data;
+	size_t row_len = 2 * desc->width * ST7735S_PIXEL_SIZE;
+	struct spi_buf tx_buf[2] = {
+		{ .buf = data->dbl_row, .len = row_len },
+		{ .buf = data->dbl_row, .len = row_len },
+	};
+	struct spi_buf_set tx_bufs = { .buffers = tx_buf, .count = 2 };
+	int ret;
+
+	__ASSERT(row_len <= sizeof(data->dbl_row), "Window too wide");
+
+	ret = st7735s_transmit(dev, ST7735S_CMD_RAMWR, NULL, 0);
+	if (ret < 0) {
+		return ret;
+	}
+
+	st7735s_set_cmd(dev, 0);
+
+	for (uint16_t row = 0; row < desc->height; row++) {
+		const uint8_t *px = src + row * desc->pitch * ST7735S_PIXEL_SIZE;
+		uint32_t *dst = data->dbl_row;
+
+		for (uint16_t col = 0; col < desc->width; col++) {
+			uint32_t c = UNALIGNED_GET((const uint16_t *)px);
+
+			/* Same two bytes twice, whatever the CPU byte order */
+			*dst++ = (c << 16) | c;
+			px += ST7735S_PIXEL_SIZE;
+		}
+
+		ret = st7735s_spi_write(dev, &config->bus, &tx_bufs);
+		if (ret < 0) {
+			return ret;
+		}
+	}
+
+	return 0;
+}
+#endif /* CONFIG_ST7735S_PIXEL_DOUBLING && !CONFIG_ST7735S_SWAP_RGB565 */
+
+#if !defined(CONFIG_ST7735S_SWAP_RGB565) && !defined(CONFIG_ST7735S_PIXEL_DOUBLING)
+/* Stream a window of big endian RGB565 pixels straight from the buffer */
+static int st7735s_write_direct(const struct device *dev,
+				const struct display_buffer_descriptor *desc,
+				const uint8_t *write_data_start)
+{
+	const struct st7735s_config *config = dev->config;
+	struct spi_buf tx_buf;
+	struct spi_buf_set tx_bufs;
+	uint16_t write_cnt;
+	uint16_t nbr_of_writes;
+	uint16_t write_h;
+	int ret;
+
+	if (desc->pitch > desc->width) {
+		write_h = 1U;
+		nbr_of_writes = desc->height;
+	} else {
+		write_h = desc->height;
+		nbr_of_writes = 1U;
+	}
+
+	ret = st7735s_transmit(dev, ST7735S_CMD_RAMWR,
+			       (void *) write_data_start,
+			       desc->width * ST7735S_PIXEL_SIZE * write_h);
+	if (ret < 0) {
+		return ret;
+	}
+
+	tx_bufs.buffers = &tx_buf;
+	tx_bufs.count = 1;
+
+	write_data_start += (desc->pitch * ST7735S_PIXEL_SIZE);
+	for (write_cnt = 1U; write_cnt < nbr_of_writes; ++write_cnt) {
+		tx_buf.buf = (void *)write_data_start;
+		tx_buf.len = desc->width * ST7735S_PIXEL_SIZE * write_h;
+		ret = st7735s_spi_write(dev, &config->bus, &tx_bufs);
+		if (ret < 0) {
+			return ret;
+		}
+
+		write_data_start += (desc->pitch * ST7735S_PIXEL_SIZE);
+	}
+
+	return 0;
+}
+#endif
+
+static int st7735s_write_window(const struct device *dev,
+				const uint16_t x,
+				const uint16_t y,
+				const struct display_buffer_descriptor *desc,
+				const void *buf)
+{
+	const uint8_t *write_data_start = (uint8_t *) buf;
+	/* Panel pixels per framebuffer pixel along each axis */
+	uint16_t scale = IS_ENABLED(CONFIG_ST7735S_PIXEL_DOUBLING) ? 2 : 1;
+	int ret;
+
+	__ASSERT(desc->width <= desc->pitch, "Pitch is smaller than width");
+	__ASSERT((desc->pitch * ST7735S_PIXEL_SIZE * desc->height)
+		 <= desc->buf_size, "Input buffer too small");
+
+	LOG_DBG("Writing %dx%d (w,h) @ %dx%d (x,y)",
+		desc->width, desc->height, x, y);
+
+	ret = st7735s_set_mem_area(dev, scale * x, scale * y,
+				   scale * desc->width, scale * desc->height);
+	if (ret < 0) {
+		return ret;
+	}
+
+#ifdef CONFIG_ST7735S_RGB444
+	if (st7735s_is_rgb444(dev)) {
+		return st7735s_write_rgb444(dev, desc, write_data_start);
+	}
+#endif
+
+#if defined(CONFIG_ST7735S_SWAP_RGB565)
+	return st7735s_write_swapped(dev, desc, write_data_start, scale);
+#elif defined(CONFIG_ST7735S_PIXEL_DOUBLING)
+	return st7735s_write_doubled(dev, desc, write_data_start);
+#else
+	return st7735s_write_direct(dev, desc, write_data_start);
+#endif
+}
+
+#ifdef CONFIG_ST7735S_TILE_DIFF
+/* Columns of dirty tiles sharing a window, tall enough for all bands so far */
+struct st7735s_tile_span {
+	uint8_t c0;
+	uint8_t c1;
+	uint16_t y0;
+	uint16_t h;
+};
+
+static void st7735s_tiles_invalidate(const struct device *dev)
+{
+	const struct st7735s_config *config = dev->config;
+	struct st7735s_data *data = dev->data;
+
+	memset(data->tile_hash, 0, config->tile_count * sizeof(uint32_t));
+}
+
+/*
+ * FNV-1a style hash over 16-bit pixels. Seeding with the rectangle makes a
+ * partially covered tile match only the very same partial write, any other
+ * write to the tile in between changes the stored hash.
+ */
+static uint32_t st7735s_tile_hash(const uint8_t *src, uint16_t pitch,
+				  uint16_t x, uint16_t y, uint16_t w, uint16_t h)
+{
+	uint32_t hash = 2166136261u ^
+			((uint32_t)x << 24 | (uint32_t)y << 16 | w << 8 | h);
+
+	for (uint16_t row = 0; row < h; row++) {
+		const uint8_t *p = src + row * pitch * ST7735S_PIXEL_SIZE;
+
+		for (uint16_t col = 0; col < w; col++) {
+			hash = (hash ^ UNALIGNED_GET((const uint16_t *)p)) *
+			       16777619u;
+			p += ST7735S_PIXEL_SIZE;
+		}
+	}
+
+	/* 0 marks a tile with unknown content */
+	return hash ? hash : 1;
+}
+
+static int st7735s_write_span(const struct device *dev, uint16_t x, uint16_t y,
+			      const struct display_buffer_descriptor *desc,
+			      const uint8_t *buf,
+			      const struct st7735s_tile_span *span)
+{
+	uint16_t x0 = MAX(x, span->c0 * CONFIG_ST7735S_TILE_SIZE);
+	uint16_t x1 = MIN(x + desc->width,
+			  (span->c1 + 1) * CONFIG_ST7735S_TILE_SIZE);
+	size_t offset = ((size_t)(span->y0 - y) * desc->pitch + (x0 - x)) *
+			ST7735S_PIXEL_SIZE;
+	struct display_buffer_descriptor window = {
+		.buf_size = desc->buf_size - offset,
+		.width = x1 - x0,
+		.height = span->h,
+		.pitch = desc->pitch,
+	};
+
+	return st7735s_write_window(dev, x0, span->y0, &window, buf + offset);
+}
+
+/*
+ * Send only the tiles whose content differs from what the panel shows.
+ * Dirty tiles next to each other form one window per tile row, windows
+ * covering the same tile columns in consecutive tile rows are merged.
+ */
+static int st7735s_write_tiles(const struct device *dev,
+			       const uint16_t x,
+			       const uint16_t y,
+			       const struct display_buffer_descriptor *desc,
+			       const void *buf)
+{
+	const struct st7735s_config *config = dev->config;
+	struct st7735s_data *data = dev->data;
+	struct st7735s_tile_span pending[ST7735S_TILE_MAX_SPANS];
+	struct st7735s_tile_span runs[ST7735S_TILE_MAX_SPANS];
+	size_t n_pending = 0;
+	uint16_t x_end = x + desc->width;
+	uint16_t y_end = y + desc->height;
+	uint16_t c_first = x / CONFIG_ST7735S_TILE_SIZE;
+	uint16_t c_last = (x_end - 1) / CONFIG_ST7735S_TILE_SIZE;
+	int ret;
+
+	if (desc->width == 0 || desc->height == 0) {
+		return 0;
+	}
+
+	for (uint16_t by = y; by < y_end;) {
+		uint16_t r = by / CONFIG_ST7735S_TILE_SIZE;
+		uint16_t band_end = MIN(y_end, (r + 1) * CONFIG_ST7735S_TILE_SIZE);
+		size_t n_runs = 0;
+		size_t n_next = 0;
+
+		for (uint16_t c = c_first; c <= c_last; c++) {
+			uint16_t tx0 = MAX(x, c * CONFIG_ST7735S_TILE_SIZE);
+			uint16_t tx1 = MIN(x_end, (c + 1) * CONFIG_ST7735S_TILE_SIZE);
+			uint32_t *stored = &data->tile_hash[r * config->tile_stride + c];
+			uint32_t hash = st7735s_tile_hash(
+				(const uint8_t *)buf + ((by - y) * desc->pitch +
+							(tx0 - x)) * ST7735S_PIXEL_SIZE,
+				desc->pitch, tx0, by, tx1 - tx0, band_end - by);
+
+			if (*stored == hash) {
+				continue;
+			}
+
+			*stored = hash;
+
+			if (n_runs > 0 && runs[n_runs - 1].c1 == c - 1) {
+				runs[n_runs - 1].c1 = c;
+			} else {
+				runs[n_runs++] = (struct st7735s_tile_span){
+					.c0 = c, .c1 = c, .y0 = by,
+					.h = band_end - by,
+				};
+			}
+		}
+
+		/* Grow windows continued by this band, send the others */
+		for (size_t i = 0; i < n_pending; i++) {
+			bool continued = false;
+
+			for (size_t j = 0; j < n_runs; j++) {
+				if (runs[j].h != 0 && runs[j].c0 == pending[i].c0 &&
+				    runs[j].c1 == pending[i].c1) {
+					pending[i].h += runs[j].h;
+					runs[j].h = 0;
+					continued = true;
+					break;
+				}
+			}
+
+			if (continued) {
+				pending[n_next++] = pending[i];
+				continue;
+			}
+
+			ret = st7735s_write_span(dev, x, y, desc, buf, &pending[i]);
+			if (ret < 0) {
+				goto fail;
+			}
+		}
+
+		for (size_t j = 0; j < n_runs; j++) {
+			if (runs[j].h != 0) {
+				pending[n_next++] = runs[j];
+			}
 		}
+
+		n_pending = n_next;
+		by = band_end;
 	}
 
-	k_sleep(ST7735S_EXIT_SLEEP_TIME);
+	for (size_t i = 0; i < n_pending; i++) {
+		ret = st7735s_write_span(dev, x, y, desc, buf, &pending[i]);
+		if (ret < 0) {
+			goto fail;
+		}
+	}
 
 	return 0;
+
+fail:
+	/* Hashes are stored ahead of the windows, some never made it out */
+	st7735s_tiles_invalidate(dev);
+
+	return ret;
 }
+#endif /* CONFIG_ST7735S_TILE_DIFF */
 
-static int st7735s_blanking_on(const struct device *dev)
+static int st7735s_write_area(const struct device *dev,
+			      const uint16_t x,
+			      const uint16_t y,
+			      const struct display_buffer_descriptor *desc,
+			      const void *buf)
 {
-	return st7735s_transmit(dev, ST7735S_CMD_DISP_OFF, NULL, 0);
+#ifdef CONFIG_ST7735S_TILE_DIFF
+	return st7735s_write_tiles(dev, x, y, desc, buf);
+#else
+	return st7735s_write_window(dev, x, y, desc, buf);
+#endif
 }
 
-static int st7735s_blanking_off(const struct device *dev)
+/*
+ * Take the panel for a write, st7735s_write_end() must follow. Only a
+ * write with @p sync set lines up with the panel frame start.
+ */
+static int st7735s_write_begin(const struct device *dev, bool sync)
 {
-	return st7735s_transmit(dev, ST7735S_CMD_DISP_ON, NULL, 0);
+	int ret = 0;
+
+#ifdef CONFIG_ST7735S_FRAME_SYNC
+	if (sync) {
+		st7735s_sync_frame(dev);
+	}
+#else
+	ARG_UNUSED(sync);
+#endif
+
+	st7735s_lock(dev);
+
+#if CONFIG_ST7735S_STATIC_TIMEOUT_MS > 0
+	ret = st7735s_leave_static(dev);
+#endif
+
+	return ret;
 }
 
-static int st7735s_read(const struct device *dev,
-			const uint16_t x,
-			const uint16_t y,
-			const struct display_buffer_descriptor *desc,
-			void *buf)
+static void st7735s_write_end(const struct device *dev, uint32_t start)
 {
-	return -ENOTSUP;
+	__maybe_unused struct st7735s_data *data = dev->data;
+
+	st7735s_unlock(dev);
+
+#if CONFIG_ST7735S_STATIC_TIMEOUT_MS > 0
+	k_work_reschedule(&data->static_work,
+			  K_MSEC(CONFIG_ST7735S_STATIC_TIMEOUT_MS));
+#endif
+
+#ifdef CONFIG_ST7735S_STATS
+	st7735s_stats_write(dev, k_cycle_get_32() - start);
+#else
+	ARG_UNUSED(start);
+#endif
 }
 
-static int st7735s_set_mem_area(const struct device *dev,
-				const uint16_t x, const uint16_t y,
-				const uint16_t w, const uint16_t h)
+int st7735s_write_interleaved(const struct st7735s_write_req *reqs,
+			      size_t count)
 {
-	struct st7735s_data *data = dev->data;
-	uint16_t spi_data[2];
+	uint32_t start = k_cycle_get_32();
+	uint16_t height = 0;
+	size_t begun;
+	int ret = 0;
 
-	int ret;
+	/* One frame start for the set, the first panel's */
+	for (begun = 0; begun < count; begun++) {
+		ret = st7735s_write_begin(reqs[begun].dev, begun == 0);
+		if (ret < 0) {
+			/* The lock is held regardless, release it below */
+			begun++;
+			goto out;
+		}
 
-	uint16_t ram_x = x + data->x_offset;
-	uint16_t ram_y = y + data->y_offset;
+		height = MAX(height, reqs[begun].desc->height);
+	}
 
-	spi_data[0] = sys_cpu_to_be16(ram_x);
-	spi_data[1] = sys_cpu_to_be16(ram_x + w - 1);
-	ret = st7735s_transmit(dev, ST7735S_CMD_CASET, (uint8_t *)&spi_data[0], 4);
-	if (ret < 0) {
-		return ret;
+	/*
+	 * Every chunk is a window of its own, so the panels can take turns on
+	 * the bus without any of them losing its RAMWR address counter.
+	 */
+	for (uint16_t row = 0; row < height;
+	     row += CONFIG_ST7735S_INTERLEAVE_ROWS) {
+		for (size_t i = 0; i < count; i++) {
+			const struct display_buffer_descriptor *desc =
+				reqs[i].desc;
+			struct display_buffer_descriptor chunk = *desc;
+			size_t offset = (size_t)row * desc->pitch *
+					ST7735S_PIXEL_SIZE;
+
+			if (row >= desc->height) {
+				continue;
+			}
+
+			chunk.height = MIN(CONFIG_ST7735S_INTERLEAVE_ROWS,
+					   desc->height - row);
+			chunk.buf_size = desc->buf_size - offset;
+
+			ret = st7735s_write_area(reqs[i].dev, reqs[i].x,
+						 reqs[i].y + row, &chunk,
+						 (const uint8_t *)reqs[i].buf +
+						 offset);
+			if (ret < 0) {
+				goto out;
+			}
+		}
 	}
 
-	spi_data[0] = sys_cpu_to_be16(ram_y);
-	spi_data[1] = sys_cpu_to_be16(ram_y + h - 1);
-	ret = st7735s_transmit(dev, ST7735S_CMD_RASET, (uint8_t *)&spi_data[0], 4);
-	if (ret < 0) {
-		return ret;
+out:
+	while (begun-- > 0) {
+		st7735s_write_end(reqs[begun].dev, start);
 	}
 
-	return 0;
+	return ret;
 }
 
 static int st7735s_write(const struct device *dev,
@@ -194,56 +1737,31 @@ static int st7735s_write(const struct device *dev,
 			 const void *buf)
 {
 	const struct st7735s_config *config = dev->config;
-	const uint8_t *write_data_start = (uint8_t *) buf;
-	struct spi_buf tx_buf;
-	struct spi_buf_set tx_bufs;
-	uint16_t write_cnt;
-	uint16_t nbr_of_writes;
-	uint16_t write_h;
+	uint32_t start = k_cycle_get_32();
 	int ret;
 
-	__ASSERT(desc->width <= desc->pitch, "Pitch is smaller than width");
-	__ASSERT((desc->pitch * ST7735S_PIXEL_SIZE * desc->height)
-		 <= desc->buf_size, "Input buffer too small");
+	if (config->mirror_count > 0) {
+		struct st7735s_write_req reqs[1 + ST7735S_MAX_MIRRORS];
 
-	LOG_DBG("Writing %dx%d (w,h) @ %dx%d (x,y)",
-		desc->width, desc->height, x, y);
-	ret = st7735s_set_mem_area(dev, x, y, desc->width, desc->height);
-	if (ret < 0) {
-		return ret;
-	}
+		reqs[0] = (struct st7735s_write_req){
+			.dev = dev, .x = x, .y = y, .desc = desc, .buf = buf,
+		};
+		for (size_t i = 0; i < config->mirror_count; i++) {
+			reqs[i + 1] = reqs[0];
+			reqs[i + 1].dev = config->mirrors[i];
+		}
 
-	if (desc->pitch > desc->width) {
-		write_h = 1U;
-		nbr_of_writes = desc->height;
-	} else {
-		write_h = desc->height;
-		nbr_of_writes = 1U;
+		return st7735s_write_interleaved(reqs, 1 + config->mirror_count);
 	}
 
-	ret = st7735s_transmit(dev, ST7735S_CMD_RAMWR,
-			       (void *) write_data_start,
-			       desc->width * ST7735S_PIXEL_SIZE * write_h);
-	if (ret < 0) {
-		return ret;
+	ret = st7735s_write_begin(dev, true);
+	if (ret == 0) {
+		ret = st7735s_write_area(dev, x, y, desc, buf);
 	}
 
-	tx_bufs.buffers = &tx_buf;
-	tx_bufs.count = 1;
-
-	write_data_start += (desc->pitch * ST7735S_PIXEL_SIZE);
-	for (write_cnt = 1U; write_cnt < nbr_of_writes; ++write_cnt) {
-		tx_buf.buf = (void *)write_data_start;
-		tx_buf.len = desc->width * ST7735S_PIXEL_SIZE * write_h;
-		ret = spi_write_dt(&config->bus, &tx_bufs);
-		if (ret < 0) {
-			return ret;
-		}
-
-		write_data_start += (desc->pitch * ST7735S_PIXEL_SIZE);
-	}
+	st7735s_write_end(dev, start);
 
-	return 0;
+	return ret;
 }
 
 static void *st7735s_get_framebuffer(const struct device *dev)
@@ -268,9 +1786,17 @@ static void st7735s_get_capabilities(const struct device *dev,
 {
 	const struct st7735s_config *config = dev->config;
 
+	struct st7735s_data *data = dev->data;
+
 	memset(capabilities, 0, sizeof(struct display_capabilities));
-	capabilities->x_resolution = config->width;
-	capabilities->y_resolution = config->height;
+	capabilities->x_resolution = data->width;
+	capabilities->y_resolution = data->height;
+
+#ifdef CONFIG_ST7735S_PIXEL_DOUBLING
+	/* Every framebuffer pixel covers 2x2 panel pixels */
+	capabilities->x_resolution /= 2;
+	capabilities->y_resolution /= 2;
+#endif
 
 	/*
 	 * Invert the pixel format if rgb_is_inverted is enabled.
@@ -288,7 +1814,7 @@ static void st7735s_get_capabilities(const struct device *dev,
 		capabilities->current_pixel_format = PIXEL_FORMAT_RGB_565;
 	}
 
-	capabilities->current_orientation = DISPLAY_ORIENTATION_NORMAL;
+	capabilities->current_orientation = data->orientation;
 }
 
 static int st7735s_set_pixel_format(const struct device *dev,
@@ -311,134 +1837,307 @@ static int st7735s_set_pixel_format(const struct device *dev,
 	return -ENOTSUP;
 }
 
+static int st7735s_orient_panel(const struct device *dev,
+				const enum display_orientation orientation)
+{
+	const struct st7735s_config *config = dev->config;
+	struct st7735s_data *data = dev->data;
+	uint8_t madctl = config->madctl;
+	uint16_t x_offset = config->x_offset;
+	uint16_t y_offset = config->y_offset;
+	uint16_t width = config->width;
+	uint16_t height = config->height;
+	uint16_t ram_width;
+	uint16_t ram_height;
+	uint16_t tmp;
+	int ret;
+
+	if (config->madctl & ST7735S_MADCTL_MV) {
+		ram_width = ST7735S_RAM_HEIGHT;
+		ram_height = ST7735S_RAM_WIDTH;
+	} else {
+		ram_width = ST7735S_RAM_WIDTH;
+		ram_height = ST7735S_RAM_HEIGHT;
+	}
+
+	/*
+	 * Walk from the devicetree orientation one quarter turn (clockwise)
+	 * at a time. Each turn exchanges rows and columns (MV) and mirrors
+	 * the axis that becomes the new column axis, so the controller does
+	 * the rotation while scanning frame memory. The visible window moves
+	 * inside the frame memory accordingly.
+	 */
+	for (int i = 0; i < (int)orientation; i++) {
+		if (madctl & ST7735S_MADCTL_MV) {
+			madctl &= ~ST7735S_MADCTL_MV;
+			madctl ^= ST7735S_MADCTL_MY;
+		} else {
+			madctl |= ST7735S_MADCTL_MV;
+			madctl ^= ST7735S_MADCTL_MX;
+		}
+
+		tmp = x_offset;
+		x_offset = y_offset;
+		y_offset = ram_width - width - tmp;
+
+		tmp = width;
+		width = height;
+		height = tmp;
+
+		tmp = ram_width;
+		ram_width = ram_height;
+		ram_height = tmp;
+	}
+
+	st7735s_lock(dev);
+
+	ret = st7735s_transmit(dev, ST7735S_CMD_MADCTL, &madctl, 1);
+	if (ret == 0) {
+		data->madctl = madctl;
+		data->width = width;
+		data->height = height;
+		data->orientation = orientation;
+		st7735s_set_lcd_margins(dev, x_offset, y_offset);
+
+#ifdef CONFIG_ST7735S_TILE_DIFF
+		/* Same content would land on other pixels now */
+		st7735s_tiles_invalidate(dev);
+#endif
+	}
+
+	st7735s_unlock(dev);
+
+	return ret;
+}
+
+/* Mirror panels turn along, relative to their own devicetree orientation */
 static int st7735s_set_orientation(const struct device *dev,
 				   const enum display_orientation orientation)
 {
-	if (orientation == DISPLAY_ORIENTATION_NORMAL) {
-		return 0;
+	const struct st7735s_config *config = dev->config;
+	int ret;
+
+	if (orientation > DISPLAY_ORIENTATION_ROTATED_270) {
+		return -EINVAL;
 	}
 
-	LOG_ERR("Changing display orientation not implemented");
+	ret = st7735s_orient_panel(dev, orientation);
 
-	return -ENOTSUP;
+	for (size_t i = 0; i < config->mirror_count && ret == 0; i++) {
+		ret = st7735s_orient_panel(config->mirrors[i], orientation);
+	}
+
+	return ret;
 }
 
-static int st7735s_lcd_init(const struct device *dev)
+#ifdef CONFIG_ST7735S_BOOT_SPLASH
+/*
+ * Fill frame memory with the boot splash before the display is switched
+ * on. Runs are decoded from flash into a small stack buffer, big endian
+ * RGB565 as the controller takes it, so no frame is held in RAM.
+ */
+static int st7735s_send_splash(const struct device *dev)
 {
+	const struct st7735s_splash *splash = st7735s_boot_splash(dev);
 	const struct st7735s_config *config = dev->config;
 	struct st7735s_data *data = dev->data;
+	uint8_t buf[ST7735S_SPLASH_CHUNK * ST7735S_PIXEL_SIZE];
+	struct spi_buf tx_buf = { .buf = buf };
+	struct spi_buf_set tx_bufs = { .buffers = &tx_buf, .count = 1 };
+	uint8_t colmod = ST7735S_COLMOD_16BIT;
+	uint16_t color = 0;
+	uint16_t x0;
+	uint16_t y0;
+	size_t rle = 0;
+	size_t run = 0;
+	size_t n = 0;
 	int ret;
 
-	st7735s_set_lcd_margins(dev, data->x_offset, data->y_offset);
-
-	ret = st7735s_transmit(dev, ST7735S_CMD_FRMCTR1, config->frmctr1,
-			       sizeof(config->frmctr1));
-	if (ret < 0) {
-		return ret;
+	if (splash == NULL) {
+		return 0;
 	}
 
-	ret = st7735s_transmit(dev, ST7735S_CMD_FRMCTR2, config->frmctr2,
-			       sizeof(config->frmctr2));
-	if (ret < 0) {
-		return ret;
+	if (splash->width > data->width || splash->height > data->height) {
+		LOG_WRN("Boot splash %ux%u does not fit", splash->width,
+			splash->height);
+		return 0;
 	}
 
-	ret = st7735s_transmit(dev, ST7735S_CMD_FRMCTR3, config->frmctr3,
-			       sizeof(config->frmctr3));
-	if (ret < 0) {
-		return ret;
+	x0 = (data->width - splash->width) / 2;
+	y0 = (data->height - splash->height) / 2;
+
+	/* The splash is RGB565, switch a 12-bit panel over for a moment */
+	if (st7735s_is_rgb444(dev)) {
+		ret = st7735s_transmit(dev, ST7735S_CMD_COLMOD, &colmod, 1);
+		if (ret < 0) {
+			return ret;
+		}
 	}
 
-	ret = st7735s_transmit(dev, ST7735S_CMD_INVCTR, &config->invctr, 1);
+	ret = st7735s_set_mem_area(dev, 0, 0, data->width, data->height);
 	if (ret < 0) {
 		return ret;
 	}
 
-	ret = st7735s_transmit(dev, ST7735S_CMD_PWCTR1, config->pwctr1,
-			       sizeof(config->pwctr1));
+	ret = st7735s_transmit(dev, ST7735S_CMD_RAMWR, NULL, 0);
 	if (ret < 0) {
 		return ret;
 	}
 
-	ret = st7735s_transmit(dev, ST7735S_CMD_PWCTR2, config->pwctr2,
-			       sizeof(config->pwctr2));
-	if (ret < 0) {
-		return ret;
+	st7735s_set_cmd(dev, 0);
+
+	for (uint16_t y = 0; y < data->height; y++) {
+		for (uint16_t x = 0; x < data->width; x++) {
+			uint16_t px = splash->bg;
+
+			if (x >= x0 && x < x0 + splash->width &&
+			    y >= y0 && y < y0 + splash->height) {
+				/* A truncated image ends in background */
+				if (run == 0 && rle + 3 <= splash->rle_len) {
+					run = splash->rle[rle] + 1;
+					color = sys_get_be16(&splash->rle[rle + 1]);
+					rle += 3;
+				}
+
+				if (run != 0) {
+					px = color;
+					run--;
+				}
+			}
+
+			sys_put_be16(px, &buf[n * ST7735S_PIXEL_SIZE]);
+
+			if (++n == ST7735S_SPLASH_CHUNK) {
+				tx_buf.len = sizeof(buf);
+				ret = st7735s_spi_write(dev, &config->bus,
+							&tx_bufs);
+				if (ret < 0) {
+					return ret;
+				}
+				n = 0;
+			}
+		}
 	}
 
-	ret = st7735s_transmit(dev, ST7735S_CMD_PWCTR3, config->pwctr3,
-			       sizeof(config->pwctr3));
-	if (ret < 0) {
-		return ret;
+	if (n != 0) {
+		tx_buf.len = n * ST7735S_PIXEL_SIZE;
+		ret = st7735s_spi_write(dev, &config->bus, &tx_bufs);
+		if (ret < 0) {
+			return ret;
+		}
 	}
 
-	ret = st7735s_transmit(dev, ST7735S_CMD_PWCTR4, config->pwctr4,
-			       sizeof(config->pwctr4));
-	if (ret < 0) {
-		return ret;
+	if (st7735s_is_rgb444(dev)) {
+		ret = st7735s_transmit(dev, ST7735S_CMD_COLMOD, &config->colmod,
+				       1);
 	}
 
-	ret = st7735s_transmit(dev, ST7735S_CMD_PWCTR5, config->pwctr5,
-			       sizeof(config->pwctr5));
+	return ret;
+}
+#endif /* CONFIG_ST7735S_BOOT_SPLASH */
+
+static int st7735s_lcd_init(const struct device *dev)
+{
+	const struct st7735s_config *config = dev->config;
+	struct st7735s_data *data = dev->data;
+	int ret;
+
+	st7735s_set_lcd_margins(dev, data->x_offset, data->y_offset);
+
+#ifdef CONFIG_ST7735S_TILE_DIFF
+	/* Frame memory content is undefined after reset */
+	st7735s_tiles_invalidate(dev);
+#endif
+
+	ret = st7735s_transmit_table(dev, config->init_cmds,
+				     config->init_cmds_len);
 	if (ret < 0) {
 		return ret;
 	}
 
-	ret = st7735s_transmit(dev, ST7735S_CMD_VMCTR1, &config->vmctr1, 1);
-	if (ret < 0) {
-		return ret;
+	/* Keep the orientation and theme selected at runtime */
+	if (data->madctl != config->madctl) {
+		ret = st7735s_transmit(dev, ST7735S_CMD_MADCTL, &data->madctl, 1);
+		if (ret < 0) {
+			return ret;
+		}
 	}
 
-	if (config->inversion_on) {
-		ret = st7735s_transmit(dev, ST7735S_CMD_INV_ON, NULL, 0);
-	} else {
-		ret = st7735s_transmit(dev, ST7735S_CMD_INV_OFF, NULL, 0);
+	if (data->inverted) {
+		ret = st7735s_send_inversion(dev);
+		if (ret < 0) {
+			return ret;
+		}
 	}
-	if (ret < 0) {
-		return ret;
+
+	if (data->gamma_alt) {
+		ret = st7735s_send_gamma(dev);
+		if (ret < 0) {
+			return ret;
+		}
 	}
 
-	ret = st7735s_transmit(dev, ST7735S_CMD_MADCTL, &config->madctl, 1);
-	if (ret < 0) {
-		return ret;
+	if (st7735s_has_partial_area(data)) {
+		ret = st7735s_send_partial_area(dev);
+		if (ret < 0) {
+			return ret;
+		}
 	}
 
-	ret = st7735s_transmit(dev, ST7735S_CMD_COLMOD, &config->colmod, 1);
-	if (ret < 0) {
-		return ret;
+	if (data->partial) {
+		ret = st7735s_send_scan_mode(dev, true);
+		if (ret < 0) {
+			return ret;
+		}
 	}
 
-	ret = st7735s_transmit(dev, ST7735S_CMD_CASET, config->caset,
-			       sizeof(config->caset));
-	if (ret < 0) {
-		return ret;
+	if (data->idle) {
+		ret = st7735s_send_idle(dev, true);
+		if (ret < 0) {
+			return ret;
+		}
 	}
 
-	ret = st7735s_transmit(dev, ST7735S_CMD_RASET, config->raset,
-			       sizeof(config->raset));
-	if (ret < 0) {
-		return ret;
+#ifdef CONFIG_ST7735S_FRAME_SYNC
+	if (config->te.port != NULL) {
+		uint8_t te_mode = 0x00; /* V-blanking information only */
+
+		ret = st7735s_transmit(dev, ST7735S_CMD_TEON, &te_mode, 1);
+		if (ret < 0) {
+			return ret;
+		}
 	}
+#endif
 
-	ret = st7735s_transmit(dev, ST7735S_CMD_GAMCTRP1, config->gamctrp1,
-			       sizeof(config->gamctrp1));
+#ifdef CONFIG_ST7735S_BOOT_SPLASH
+	ret = st7735s_send_splash(dev);
 	if (ret < 0) {
 		return ret;
 	}
+#endif
 
-	ret = st7735s_transmit(dev, ST7735S_CMD_GAMCTRN1, config->gamctrn1,
-			       sizeof(config->gamctrn1));
+	return st7735s_transmit(dev, ST7735S_CMD_DISP_ON, NULL, 0);
+}
+
+static int st7735s_power_up(const struct device *dev)
+{
+	int ret;
+
+	ret = st7735s_reset_display(dev);
 	if (ret < 0) {
+		LOG_ERR("Couldn't reset display");
 		return ret;
 	}
 
-	ret = st7735s_transmit(dev, ST7735S_CMD_NORON, NULL, 0);
+	ret = st7735s_exit_sleep(dev);
 	if (ret < 0) {
+		LOG_ERR("Couldn't exit sleep");
 		return ret;
 	}
 
-	ret = st7735s_transmit(dev, ST7735S_CMD_DISP_ON, NULL, 0);
+	ret = st7735s_lcd_init(dev);
 	if (ret < 0) {
+		LOG_ERR("Couldn't init LCD");
 		return ret;
 	}
 
@@ -448,6 +2147,7 @@ static int st7735s_lcd_init(const struct device *dev)
 static int st7735s_init(const struct device *dev)
 {
 	const struct st7735s_config *config = dev->config;
+	__maybe_unused struct st7735s_data *data = dev->data;
 	int ret;
 
 	if (!spi_is_ready_dt(&config->bus)) {
@@ -455,6 +2155,11 @@ static int st7735s_init(const struct device *dev)
 		return -ENODEV;
 	}
 
+	if (st7735s_is_rgb444(dev) && !IS_ENABLED(CONFIG_ST7735S_RGB444)) {
+		LOG_ERR("12-bit colmod requires CONFIG_ST7735S_RGB444");
+		return -ENOTSUP;
+	}
+
 	if (config->reset.port != NULL) {
 		if (!gpio_is_ready_dt(&config->reset)) {
 			LOG_ERR("Reset GPIO port for display not ready");
@@ -480,23 +2185,28 @@ static int st7735s_init(const struct device *dev)
 		return ret;
 	}
 
-	ret = st7735s_reset_display(dev);
-	if (ret < 0) {
-		LOG_ERR("Couldn't reset display");
-		return ret;
-	}
+#if defined(CONFIG_ST7735S_SWAP_RGB565) && defined(CONFIG_SPI_ASYNC)
+	k_poll_signal_init(&data->bounce_sig);
+#endif
 
-	ret = st7735s_exit_sleep(dev);
+	ret = st7735s_power_up(dev);
 	if (ret < 0) {
-		LOG_ERR("Couldn't exit sleep");
 		return ret;
 	}
 
-	ret = st7735s_lcd_init(dev);
+#ifdef CONFIG_ST7735S_FRAME_SYNC
+	ret = st7735s_frame_sync_init(dev);
 	if (ret < 0) {
-		LOG_ERR("Couldn't init LCD");
+		LOG_ERR("Couldn't set up frame synchronization");
 		return ret;
 	}
+#endif
+
+#if CONFIG_ST7735S_STATIC_TIMEOUT_MS > 0
+	data->dev = dev;
+	k_mutex_init(&data->lock);
+	k_work_init_delayable(&data->static_work, st7735s_static_work_handler);
+#endif
 
 	return 0;
 }
@@ -505,14 +2215,26 @@ static int st7735s_init(const struct device *dev)
 static int st7735s_pm_action(const struct device *dev,
 			     enum pm_device_action action)
 {
+	__maybe_unused struct st7735s_data *data = dev->data;
 	int ret = 0;
 
 	switch (action) {
 	case PM_DEVICE_ACTION_RESUME:
+		/* Registers and frame memory survive SLEEP_IN */
 		ret = st7735s_exit_sleep(dev);
 		break;
 	case PM_DEVICE_ACTION_SUSPEND:
-		ret = st7735s_transmit(dev, ST7735S_CMD_SLEEP_IN, NULL, 0);
+#if CONFIG_ST7735S_STATIC_TIMEOUT_MS > 0
+		/* Nothing to save while asleep, the next write re-arms it */
+		k_work_cancel_delayable(&data->static_work);
+#endif
+		ret = st7735s_enter_sleep(dev);
+		break;
+	case PM_DEVICE_ACTION_TURN_ON:
+		/* Supply was removed, nothing is left to resume from */
+		ret = st7735s_power_up(dev);
+		break;
+	case PM_DEVICE_ACTION_TURN_OFF:
 		break;
 	default:
 		ret = -ENOTSUP;
@@ -537,37 +2259,108 @@ static const struct display_driver_api st7735s_api = {
 };
 
 
+#define ST7735S_INIT_CMD_ARRAY(inst, cmd, prop)					\
+	cmd, DT_INST_PROP_LEN(inst, prop),					\
+	DT_INST_FOREACH_PROP_ELEM_SEP(inst, prop, DT_PROP_BY_IDX, (,))
+
+#define ST7735S_INIT_CMD_INT(inst, cmd, prop)					\
+	cmd, 1, DT_INST_PROP(inst, prop)
+
+#define ST7735S_GAMMA_ARRAY(inst, p, n)						\
+	BUILD_ASSERT(DT_INST_PROP_LEN(inst, p) == ST7735S_GAMMA_SIZE &&		\
+		     DT_INST_PROP_LEN(inst, n) == ST7735S_GAMMA_SIZE,		\
+		     "gamma tables need 16 entries");				\
+	static const uint8_t st7735s_ ## p ## _ ## inst[] = {			\
+		DT_INST_FOREACH_PROP_ELEM_SEP(inst, p, DT_PROP_BY_IDX, (,)),	\
+		DT_INST_FOREACH_PROP_ELEM_SEP(inst, n, DT_PROP_BY_IDX, (,)),	\
+	};
+
+#define ST7735S_MIRROR_DEV(node_id, prop, idx)					\
+	DEVICE_DT_GET(DT_PHANDLE_BY_IDX(node_id, prop, idx))
+
+#define ST7735S_MIRRORS(inst)							\
+	BUILD_ASSERT(DT_INST_PROP_LEN(inst, mirror_displays) <=		\
+		     ST7735S_MAX_MIRRORS, "too many mirror-displays");	\
+	static const struct device *const st7735s_mirrors_ ## inst[] = {	\
+		DT_INST_FOREACH_PROP_ELEM_SEP(inst, mirror_displays,		\
+					      ST7735S_MIRROR_DEV, (,))		\
+	};
+
 #define ST7735S_INIT(inst)							\
+	ST7735S_GAMMA_ARRAY(inst, gamctrp1, gamctrn1)				\
+	IF_ENABLED(DT_INST_NODE_HAS_PROP(inst, mirror_displays),		\
+		   (ST7735S_MIRRORS(inst)))					\
+	IF_ENABLED(DT_INST_NODE_HAS_PROP(inst, gamctrp1_alt),			\
+		   (ST7735S_GAMMA_ARRAY(inst, gamctrp1_alt, gamctrn1_alt)))	\
+										\
+	static const uint8_t st7735s_init_cmds_ ## inst[] = {			\
+		ST7735S_INIT_CMD_ARRAY(inst, ST7735S_CMD_FRMCTR1, frmctr1),	\
+		ST7735S_INIT_CMD_ARRAY(inst, ST7735S_CMD_FRMCTR2, frmctr2),	\
+		ST7735S_INIT_CMD_ARRAY(inst, ST7735S_CMD_FRMCTR3, frmctr3),	\
+		ST7735S_INIT_CMD_INT(inst, ST7735S_CMD_INVCTR, invctr),		\
+		ST7735S_INIT_CMD_ARRAY(inst, ST7735S_CMD_PWCTR1, pwctr1),	\
+		ST7735S_INIT_CMD_ARRAY(inst, ST7735S_CMD_PWCTR2, pwctr2),	\
+		ST7735S_INIT_CMD_ARRAY(inst, ST7735S_CMD_PWCTR3, pwctr3),	\
+		ST7735S_INIT_CMD_ARRAY(inst, ST7735S_CMD_PWCTR4, pwctr4),	\
+		ST7735S_INIT_CMD_ARRAY(inst, ST7735S_CMD_PWCTR5, pwctr5),	\
+		ST7735S_INIT_CMD_INT(inst, ST7735S_CMD_VMCTR1, vmctr1),		\
+		DT_INST_PROP(inst, inversion_on) ?				\
+			ST7735S_CMD_INV_ON : ST7735S_CMD_INV_OFF, 0,		\
+		ST7735S_INIT_CMD_INT(inst, ST7735S_CMD_MADCTL, madctl),		\
+		ST7735S_INIT_CMD_INT(inst, ST7735S_CMD_COLMOD, colmod),		\
+		ST7735S_INIT_CMD_ARRAY(inst, ST7735S_CMD_CASET, caset),		\
+		ST7735S_INIT_CMD_ARRAY(inst, ST7735S_CMD_RASET, raset),		\
+		ST7735S_INIT_CMD_ARRAY(inst, ST7735S_CMD_GAMCTRP1, gamctrp1),	\
+		ST7735S_INIT_CMD_ARRAY(inst, ST7735S_CMD_GAMCTRN1, gamctrn1),	\
+		ST7735S_CMD_NORON, 0,						\
+	};									\
+										\
 	const static struct st7735s_config st7735s_config_ ## inst = {		\
 		.bus = SPI_DT_SPEC_INST_GET(					\
 			inst, SPI_OP_MODE_MASTER | SPI_WORD_SET(8), 0),		\
 		.cmd_data = GPIO_DT_SPEC_INST_GET(inst, cmd_data_gpios),	\
 		.reset = GPIO_DT_SPEC_INST_GET_OR(inst, reset_gpios, {}),	\
+		.te = GPIO_DT_SPEC_INST_GET_OR(inst, te_gpios, {}),		\
 		.width = DT_INST_PROP(inst, width),				\
 		.height = DT_INST_PROP(inst, height),				\
+		.x_offset = DT_INST_PROP(inst, x_offset),			\
+		.y_offset = DT_INST_PROP(inst, y_offset),			\
 		.madctl = DT_INST_PROP(inst, madctl),				\
 		.colmod = DT_INST_PROP(inst, colmod),				\
-		.caset = DT_INST_PROP(inst, caset),				\
-		.raset = DT_INST_PROP(inst, raset),				\
-		.vmctr1 = DT_INST_PROP(inst, vmctr1),				\
-		.invctr = DT_INST_PROP(inst, invctr),				\
-		.pwctr1 = DT_INST_PROP(inst, pwctr1),				\
-		.pwctr2 = DT_INST_PROP(inst, pwctr2),				\
-		.pwctr3 = DT_INST_PROP(inst, pwctr3),				\
-		.pwctr4 = DT_INST_PROP(inst, pwctr4),				\
-		.pwctr5 = DT_INST_PROP(inst, pwctr5),				\
 		.frmctr1 = DT_INST_PROP(inst, frmctr1),				\
-		.frmctr2 = DT_INST_PROP(inst, frmctr2),				\
-		.frmctr3 = DT_INST_PROP(inst, frmctr3),				\
-		.gamctrp1 = DT_INST_PROP(inst, gamctrp1),			\
-		.gamctrn1 = DT_INST_PROP(inst, gamctrn1),			\
+		.init_cmds = st7735s_init_cmds_ ## inst,			\
+		.init_cmds_len = sizeof(st7735s_init_cmds_ ## inst),		\
+		.gamma = st7735s_gamctrp1_ ## inst,				\
+		.gamma_alt = COND_CODE_1(					\
+			DT_INST_NODE_HAS_PROP(inst, gamctrp1_alt),		\
+			(st7735s_gamctrp1_alt_ ## inst), (NULL)),		\
+		.mirrors = COND_CODE_1(						\
+			DT_INST_NODE_HAS_PROP(inst, mirror_displays),		\
+			(st7735s_mirrors_ ## inst), (NULL)),			\
+		.mirror_count = DT_INST_PROP_LEN_OR(inst, mirror_displays, 0),	\
+		IF_ENABLED(CONFIG_ST7735S_TILE_DIFF, (				\
+		.tile_count = ST7735S_TILE_STRIDE(inst) *			\
+			      ST7735S_TILE_STRIDE(inst),			\
+		.tile_stride = ST7735S_TILE_STRIDE(inst),))			\
 		.inversion_on = DT_INST_PROP(inst, inversion_on),		\
 		.rgb_is_inverted = DT_INST_PROP(inst, rgb_is_inverted),		\
 	};									\
 										\
+	IF_ENABLED(CONFIG_ST7735S_TILE_DIFF, (					\
+	static uint32_t st7735s_tile_hash_ ## inst[ST7735S_TILE_STRIDE(inst) *	\
+						   ST7735S_TILE_STRIDE(inst)];))	\
+										\
 	static struct st7735s_data st7735s_data_ ## inst = {			\
 		.x_offset = DT_INST_PROP(inst, x_offset),			\
 		.y_offset = DT_INST_PROP(inst, y_offset),			\
+		.width = DT_INST_PROP(inst, width),				\
+		.height = DT_INST_PROP(inst, height),				\
+		.madctl = DT_INST_PROP(inst, madctl),				\
+		.orientation = DISPLAY_ORIENTATION_NORMAL,			\
+		.partial_start = 1,						\
+		.partial_end = 0,						\
+		IF_ENABLED(CONFIG_ST7735S_TILE_DIFF, (				\
+		.tile_hash = st7735s_tile_hash_ ## inst,))			\
 	};									\
 										\
 	PM_DEVICE_DT_INST_DEFINE(inst, st7735s_pm_action);			\
@@ -0,0 +1,91 @@
+/*
+ * Copyright (c) 2024 kristosb
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#define DT_DRV_COMPAT sitronix_st7735s
+
+#include <app/drivers/display/display_st7735s.h>
+
+#include <zephyr/device.h>
+#include <zephyr/shell/shell.h>
+#include <zephyr/sys/util.h>
+
+#define ST7735S_DEVICE(inst) DEVICE_DT_INST_GET(inst),
+
+static const struct device *const st7735s_devs[] = {
+	DT_INST_FOREACH_STATUS_OKAY(ST7735S_DEVICE)
+};
+
+static void st7735s_shell_print(const struct shell *sh,
+				const struct device *dev)
+{
+	struct st7735s_stats stats;
+	uint32_t avg_us;
+
+	if (st7735s_get_stats(dev, &stats) < 0) {
+		shell_error(sh, "%s: no statistics", dev->name);
+		return;
+	}
+
+	avg_us = stats.writes ? (uint32_t)(stats.latency_sum_us / stats.writes) : 0;
+
+	shell_print(sh, "%s:", dev->name);
+	shell_print(sh, "  writes        %u", stats.writes);
+	shell_print(sh, "  windows       %u", stats.windows);
+	shell_print(sh, "  transactions  %u", stats.transactions);
+	shell_print(sh, "  bytes         %llu", (unsigned long long)stats.bytes);
+	shell_print(sh, "  latency [us]  min %u avg %u max %u",
+		    stats.latency_min_us, avg_us, stats.latency_max_us);
+
+	for (size_t i = 0; i < ST7735S_STATS_HIST_BUCKETS; i++) {
+		if (i < ST7735S_STATS_HIST_BUCKETS - 1) {
+			shell_print(sh, "  < %3u ms      %u", 1U << i,
+				    stats.latency_hist[i]);
+		} else {
+			shell_print(sh, "  >= %2u ms      %u", 1U << (i - 1),
+				    stats.latency_hist[i]);
+		}
+	}
+}
+
+static int cmd_st7735s_stats(const struct shell *sh, size_t argc, char **argv)
+{
+	ARG_UNUSED(argc);
+	ARG_UNUSED(argv);
+
+	for (size_t i = 0; i < ARRAY_SIZE(st7735s_devs); i++) {
+		st7735s_shell_print(sh, st7735s_devs[i]);
+	}
+
+	return 0;
+}
+
+static int cmd_st7735s_stats_reset(const struct shell *sh, size_t argc,
+				   char **argv)
+{
+	ARG_UNUSED(argc);
+	ARG_UNUSED(argv);
+
+	for (size_t i = 0; i < ARRAY_SIZE(st7735s_devs); i++) {
+		st7735s_reset_stats(st7735s_devs[i]);
+	}
+
+	shell_print(sh, "Statistics cleared");
+
+	return 0;
+}
+
+SHELL_STATIC_SUBCMD_SET_CREATE(sub_st7735s_stats,
+	SHELL_CMD(reset, NULL, "Clear the statistics", cmd_st7735s_stats_reset),
+	SHELL_SUBCMD_SET_END
+);
+
+SHELL_STATIC_SUBCMD_SET_CREATE(sub_st7735s,
+	SHELL_CMD(stats, &sub_st7735s_stats,
+		  "Show write statistics", cmd_st7735s_stats),
+	SHELL_SUBCMD_SET_END
+);
+
+SHELL_CMD_REGISTER(st7735s, &sub_st7735s, "ST7735S display commands", NULL);
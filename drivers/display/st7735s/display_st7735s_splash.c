@@ -0,0 +1,172 @@
+/*
+ * Copyright (c) 2024 kristosb
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/*
+ * Default boot splash, generated by scripts/gen_st7735s_splash.py from
+ * lib/lv_pitch_ladder/assets/img_lvgl_logo.c. Do not edit.
+ */
+
+#include <app/drivers/display/display_st7735s.h>
+
+#include <zephyr/toolchain.h>
+
+static const uint8_t st7735s_splash_rle[] = {
+	0x00, 0xff, 0xff, 0x00, 0xff, 0xdf, 0x00, 0xef, 0x7d, 0x00, 0xde, 0xdb,
+	0x20, 0xd6, 0x9a, 0x00, 0xde, 0xdb, 0x00, 0xef, 0x5d, 0x00, 0xff, 0xdf,
+	0x01, 0xff, 0xff, 0x00, 0xff, 0xdf, 0x00, 0xde, 0xdb, 0x00, 0xa5, 0x14,
+	0x00, 0x73, 0x6e, 0x00, 0x5a, 0xcb, 0x1e, 0x5a, 0xab, 0x00, 0x5a, 0xcb,
+	0x00, 0x6b, 0x4d, 0x00, 0x9c, 0xd3, 0x00, 0xd6, 0x7a, 0x00, 0xf7, 0xbe,
+	0x00, 0xff, 0xff, 0x00, 0xe7, 0x1c, 0x00, 0x7b, 0xef, 0x00, 0x31, 0x86,
+	0x22, 0x21, 0x04, 0x00, 0x29, 0x45, 0x00, 0x6b, 0x4d, 0x00, 0xce, 0x79,
+	0x00, 0xff, 0xff, 0x00, 0xa4, 0xf4, 0x00, 0x39, 0xc7, 0x24, 0x21, 0x04,
+	0x00, 0x31, 0x66, 0x00, 0x8c, 0x51, 0x00, 0xf7, 0xbe, 0x00, 0x6b, 0x2d,
+	0x00, 0x29, 0x45, 0x1e, 0x21, 0x04, 0x00, 0x31, 0x86, 0x01, 0x42, 0x08,
+	0x00, 0x29, 0x66, 0x02, 0x21, 0x04, 0x00, 0x63, 0x0c, 0x00, 0xef, 0x5d,
+	0x00, 0x52, 0x8a, 0x1e, 0x21, 0x04, 0x00, 0x29, 0x45, 0x00, 0x6b, 0x6d,
+	0x00, 0xa5, 0x14, 0x00, 0xa4, 0xf4, 0x00, 0x62, 0xec, 0x00, 0x29, 0x45,
+	0x01, 0x21, 0x04, 0x00, 0x5a, 0xcb, 0x00, 0xe7, 0x1c, 0x00, 0x52, 0x8a,
+	0x1e, 0x21, 0x04, 0x00, 0x39, 0xc7, 0x00, 0xc6, 0x18, 0x00, 0xf7, 0x9e,
+	0x00, 0xef, 0x5d, 0x00, 0xa5, 0x14, 0x00, 0x42, 0x08, 0x01, 0x21, 0x04,
+	0x00, 0x5a, 0xcb, 0x00, 0xe6, 0xfc, 0x00, 0x52, 0x8a, 0x1e, 0x21, 0x04,
+	0x00, 0x41, 0xe8, 0x00, 0xde, 0xfb, 0x00, 0xff, 0xff, 0x00, 0xff, 0xbf,
+	0x00, 0xb5, 0x96, 0x00, 0x4a, 0x49, 0x01, 0x21, 0x04, 0x00, 0x5a, 0xcb,
+	0x00, 0xe6, 0xfc, 0x00, 0x52, 0x8a, 0x1e, 0x21, 0x04, 0x00, 0x29, 0x66,
+	0x00, 0x94, 0x92, 0x00, 0xd6, 0x9a, 0x00, 0xce, 0x59, 0x00, 0x7b, 0xf0,
+	0x00, 0x31, 0x86, 0x01, 0x21, 0x04, 0x00, 0x5a, 0xcb, 0x00, 0xe6, 0xfc,
+	0x00, 0x52, 0x8a, 0x1f, 0x21, 0x04, 0x00, 0x39, 0xe8, 0x00, 0x52, 0xab,
+	0x00, 0x52, 0xaa, 0x00, 0x39, 0xa7, 0x02, 0x21, 0x04, 0x00, 0x5a, 0xcb,
+	0x00, 0xe6, 0xfc, 0x00, 0x52, 0x8a, 0x26, 0x21, 0x04, 0x00, 0x5a, 0xcb,
+	0x00, 0xe6, 0xfc, 0x00, 0x5a, 0xab, 0x00, 0x21, 0x25, 0x25, 0x21, 0x04,
+	0x00, 0x5a, 0xcb, 0x00, 0xe6, 0xfc, 0x00, 0x84, 0x31, 0x00, 0x42, 0x29,
+	0x00, 0x39, 0xa7, 0x08, 0x31, 0xa7, 0x00, 0x31, 0x86, 0x00, 0x29, 0x45,
+	0x19, 0x21, 0x04, 0x00, 0x5a, 0xcb, 0x00, 0xe6, 0xfc, 0x00, 0xe7, 0x3c,
+	0x00, 0xb5, 0x76, 0x00, 0x9c, 0xd3, 0x07, 0x9c, 0xb3, 0x00, 0x94, 0xb3,
+	0x00, 0x8c, 0x72, 0x00, 0x6b, 0x4d, 0x00, 0x31, 0xa7, 0x18, 0x21, 0x04,
+	0x00, 0x5a, 0xcb, 0x00, 0xe6, 0xfc, 0x00, 0xff, 0x9e, 0x00, 0xf7, 0x1c,
+	0x00, 0xf6, 0xfb, 0x07, 0xf6, 0xdb, 0x00, 0xf7, 0x1c, 0x00, 0xef, 0x5d,
+	0x00, 0xd6, 0x7a, 0x00, 0x6b, 0x6e, 0x18, 0x21, 0x04, 0x00, 0x5a, 0xcb,
+	0x00, 0xe6, 0xfc, 0x00, 0xfd, 0xd7, 0x00, 0xf4, 0x51, 0x08, 0xec, 0x10,
+	0x00, 0xf4, 0xb2, 0x00, 0xfe, 0xbb, 0x00, 0xf7, 0x5d, 0x00, 0x8c, 0x72,
+	0x00, 0x21, 0x25, 0x17, 0x21, 0x04, 0x00, 0x5a, 0xcb, 0x00, 0xe6, 0xfc,
+	0x00, 0xea, 0xec, 0x00, 0xe1, 0x04, 0x08, 0xd8, 0xc3, 0x00, 0xe1, 0x45,
+	0x00, 0xf5, 0x34, 0x00, 0xf7, 0x5d, 0x00, 0x94, 0xb3, 0x00, 0x29, 0x25,
+	0x17, 0x21, 0x04, 0x00, 0x5a, 0xcb, 0x00, 0xe6, 0xfc, 0x00, 0xe1, 0xc7,
+	0x00, 0xd8, 0x20, 0x08, 0xd8, 0x00, 0x00, 0xd8, 0x61, 0x00, 0xf4, 0x71,
+	0x00, 0xf7, 0x3c, 0x00, 0x94, 0xb3, 0x00, 0x29, 0x25, 0x17, 0x21, 0x04,
+	0x00, 0x5a, 0xcb, 0x00, 0xe6, 0xfc, 0x00, 0xe1, 0xa7, 0x00, 0xd8, 0x20,
+	0x08, 0xd8, 0x00, 0x00, 0xd8, 0x61, 0x00, 0xf4, 0x71, 0x00, 0xf7, 0x3c,
+	0x00, 0x94, 0xb3, 0x00, 0x29, 0x25, 0x17, 0x21, 0x04, 0x00, 0x5a, 0xcb,
+	0x00, 0xe6, 0xfc, 0x00, 0xe1, 0xa7, 0x00, 0xd8, 0x20, 0x08, 0xd8, 0x00,
+	0x00, 0xd8, 0x61, 0x00, 0xf4, 0x71, 0x00, 0xf7, 0x3c, 0x00, 0x94, 0xb3,
+	0x00, 0x29, 0x25, 0x17, 0x21, 0x04, 0x00, 0x5a, 0xcb, 0x00, 0xe6, 0xfc,
+	0x00, 0xe1, 0xa7, 0x00, 0xd8, 0x20, 0x08, 0xd8, 0x00, 0x00, 0xd8, 0x61,
+	0x00, 0xf4, 0x71, 0x00, 0xf7, 0x3c, 0x00, 0x94, 0xb3, 0x00, 0x29, 0x25,
+	0x17, 0x21, 0x04, 0x00, 0x5a, 0xcb, 0x00, 0xe6, 0xfc, 0x00, 0xe1, 0xa7,
+	0x00, 0xd8, 0x20, 0x08, 0xd8, 0x00, 0x00, 0xd8, 0x61, 0x00, 0xf4, 0x71,
+	0x00, 0xf7, 0x3c, 0x00, 0x94, 0xb3, 0x00, 0x29, 0x25, 0x17, 0x21, 0x04,
+	0x00, 0x5a, 0xcb, 0x00, 0xe6, 0xfc, 0x00, 0xe1, 0xa7, 0x00, 0xd8, 0x20,
+	0x08, 0xd8, 0x00, 0x00, 0xd8, 0x61, 0x00, 0xf4, 0x71, 0x00, 0xf7, 0x3c,
+	0x00, 0x94, 0xb3, 0x00, 0x29, 0x25, 0x17, 0x21, 0x04, 0x00, 0x5a, 0xcb,
+	0x00, 0xe6, 0xfc, 0x00, 0xe1, 0xa7, 0x00, 0xd8, 0x20, 0x08, 0xd8, 0x00,
+	0x00, 0xd8, 0x61, 0x00, 0xf4, 0x71, 0x00, 0xf7, 0x3c, 0x00, 0x94, 0xb3,
+	0x00, 0x29, 0x25, 0x17, 0x21, 0x04, 0x00, 0x5a, 0xcb, 0x00, 0xe6, 0xfc,
+	0x00, 0xe1, 0xa7, 0x00, 0xd8, 0x20, 0x08, 0xd8, 0x00, 0x00, 0xd8, 0x61,
+	0x00, 0xf4, 0x71, 0x00, 0xf7, 0x3c, 0x00, 0x94, 0xb3, 0x00, 0x29, 0x25,
+	0x17, 0x21, 0x04, 0x00, 0x5a, 0xcb, 0x00, 0xe6, 0xfc, 0x00, 0xe1, 0xc7,
+	0x00, 0xd8, 0x20, 0x08, 0xd8, 0x00, 0x00, 0xd8, 0x61, 0x00, 0xf4, 0x71,
+	0x00, 0xf7, 0x3c, 0x00, 0x9c, 0xd3, 0x00, 0x29, 0x45, 0x17, 0x21, 0x04,
+	0x00, 0x5a, 0xcb, 0x00, 0xe6, 0xfc, 0x00, 0xe2, 0x69, 0x00, 0xd8, 0x82,
+	0x08, 0xd8, 0x61, 0x00, 0xd8, 0xc3, 0x00, 0xf4, 0xd3, 0x00, 0xf7, 0x5d,
+	0x00, 0xad, 0x55, 0x00, 0x41, 0xe8, 0x00, 0x29, 0x66, 0x09, 0x29, 0x45,
+	0x00, 0x21, 0x25, 0x0b, 0x21, 0x04, 0x00, 0x5a, 0xcb, 0x00, 0xe6, 0xfc,
+	0x00, 0xf4, 0xf4, 0x00, 0xeb, 0x0c, 0x08, 0xea, 0xcb, 0x00, 0xeb, 0x6d,
+	0x00, 0xfe, 0x59, 0x00, 0xff, 0xbf, 0x00, 0xd6, 0xbb, 0x00, 0x94, 0x92,
+	0x00, 0x73, 0x8e, 0x00, 0x6b, 0x6e, 0x07, 0x6b, 0x6d, 0x00, 0x6b, 0x4d,
+	0x00, 0x52, 0x8a, 0x00, 0x31, 0x86, 0x0a, 0x21, 0x04, 0x00, 0x5a, 0xcb,
+	0x00, 0xe6, 0xfc, 0x00, 0xff, 0x7e, 0x00, 0xfe, 0xdb, 0x08, 0xfe, 0x9a,
+	0x00, 0xfe, 0xfb, 0x00, 0xff, 0xbe, 0x00, 0xff, 0xff, 0x00, 0xff, 0xdf,
+	0x00, 0xef, 0x5d, 0x09, 0xde, 0xdb, 0x00, 0xde, 0xbb, 0x00, 0xc6, 0x18,
+	0x00, 0x73, 0x6e, 0x00, 0x29, 0x45, 0x09, 0x21, 0x04, 0x00, 0x5a, 0xcb,
+	0x00, 0xe6, 0xfc, 0x00, 0xff, 0x1c, 0x00, 0xf5, 0xb6, 0x08, 0xf5, 0x55,
+	0x00, 0xf5, 0xf7, 0x00, 0xff, 0x7d, 0x00, 0xff, 0xff, 0x00, 0xff, 0x5d,
+	0x00, 0xfd, 0xf8, 0x08, 0xf5, 0x55, 0x00, 0xf5, 0xd7, 0x00, 0xff, 0x1c,
+	0x00, 0xff, 0xbf, 0x00, 0x9c, 0xf3, 0x00, 0x31, 0xa7, 0x09, 0x21, 0x04,
+	0x00, 0x5a, 0xcb, 0x00, 0xe6, 0xfc, 0x00, 0xeb, 0xef, 0x00, 0xe1, 0xe7,
+	0x08, 0xe1, 0x86, 0x00, 0xe2, 0x49, 0x00, 0xf5, 0xb6, 0x00, 0xff, 0x9e,
+	0x00, 0xf5, 0x76, 0x00, 0xe2, 0x29, 0x00, 0xe1, 0xa6, 0x06, 0xe1, 0x86,
+	0x00, 0xe1, 0xa6, 0x00, 0xe1, 0xe8, 0x00, 0xf4, 0xb3, 0x00, 0xff, 0x7e,
+	0x00, 0xad, 0x35, 0x00, 0x39, 0xc7, 0x09, 0x21, 0x04, 0x00, 0x5a, 0xcb,
+	0x00, 0xe6, 0xfc, 0x00, 0xe1, 0xe7, 0x00, 0xd8, 0x21, 0x08, 0xd8, 0x00,
+	0x00, 0xd8, 0x82, 0x00, 0xf4, 0x92, 0x00, 0xff, 0x3d, 0x00, 0xf4, 0x51,
+	0x00, 0xd8, 0x62, 0x08, 0xd8, 0x00, 0x00, 0xd8, 0x41, 0x00, 0xeb, 0x6d,
+	0x00, 0xff, 0x1c, 0x00, 0xad, 0x35, 0x00, 0x39, 0xc7, 0x09, 0x21, 0x04,
+	0x00, 0x5a, 0xcb, 0x00, 0xe6, 0xfc, 0x00, 0xe1, 0xa7, 0x00, 0xd8, 0x20,
+	0x08, 0xd8, 0x00, 0x00, 0xd8, 0x61, 0x00, 0xf4, 0x71, 0x00, 0xff, 0x1c,
+	0x00, 0xec, 0x31, 0x00, 0xd8, 0x41, 0x08, 0xd8, 0x00, 0x00, 0xd8, 0x21,
+	0x00, 0xeb, 0x4d, 0x00, 0xfe, 0xfc, 0x00, 0xad, 0x35, 0x00, 0x39, 0xc7,
+	0x09, 0x21, 0x04, 0x00, 0x5a, 0xcb, 0x00, 0xe6, 0xfc, 0x00, 0xe1, 0xa7,
+	0x00, 0xd8, 0x20, 0x08, 0xd8, 0x00, 0x00, 0xd8, 0x61, 0x00, 0xf4, 0x71,
+	0x00, 0xff, 0x1c, 0x00, 0xec, 0x31, 0x00, 0xd8, 0x41, 0x08, 0xd8, 0x00,
+	0x00, 0xd8, 0x21, 0x00, 0xeb, 0x4d, 0x00, 0xfe, 0xfc, 0x00, 0xad, 0x35,
+	0x00, 0x39, 0xc7, 0x09, 0x21, 0x04, 0x00, 0x5a, 0xcb, 0x00, 0xe6, 0xfc,
+	0x00, 0xe1, 0xa7, 0x00, 0xd8, 0x20, 0x08, 0xd8, 0x00, 0x00, 0xd8, 0x61,
+	0x00, 0xf4, 0x71, 0x00, 0xff, 0x1c, 0x00, 0xec, 0x31, 0x00, 0xd8, 0x41,
+	0x08, 0xd8, 0x00, 0x00, 0xd8, 0x21, 0x00, 0xeb, 0x4d, 0x00, 0xfe, 0xfc,
+	0x00, 0xad, 0x35, 0x00, 0x39, 0xc7, 0x09, 0x21, 0x04, 0x00, 0x5a, 0xcb,
+	0x00, 0xe6, 0xfc, 0x00, 0xe1, 0xa7, 0x00, 0xd8, 0x20, 0x08, 0xd8, 0x00,
+	0x00, 0xd8, 0x61, 0x00, 0xf4, 0x71, 0x00, 0xff, 0x1c, 0x00, 0xec, 0x31,
+	0x00, 0xd8, 0x41, 0x08, 0xd8, 0x00, 0x00, 0xd8, 0x21, 0x00, 0xeb, 0x4d,
+	0x00, 0xfe, 0xfc, 0x00, 0xad, 0x35, 0x00, 0x39, 0xc7, 0x09, 0x21, 0x04,
+	0x00, 0x5a, 0xcb, 0x00, 0xe6, 0xfc, 0x00, 0xe1, 0xa7, 0x00, 0xd8, 0x20,
+	0x08, 0xd8, 0x00, 0x00, 0xd8, 0x61, 0x00, 0xf4, 0x71, 0x00, 0xff, 0x1c,
+	0x00, 0xec, 0x31, 0x00, 0xd8, 0x41, 0x08, 0xd8, 0x00, 0x00, 0xd8, 0x21,
+	0x00, 0xeb, 0x4d, 0x00, 0xfe, 0xfc, 0x00, 0xad, 0x35, 0x00, 0x39, 0xc7,
+	0x09, 0x21, 0x04, 0x00, 0x5a, 0xcb, 0x00, 0xe6, 0xfc, 0x00, 0xe1, 0xa7,
+	0x00, 0xd8, 0x20, 0x08, 0xd8, 0x00, 0x00, 0xd8, 0x61, 0x00, 0xf4, 0x71,
+	0x00, 0xff, 0x1c, 0x00, 0xec, 0x31, 0x00, 0xd8, 0x41, 0x08, 0xd8, 0x00,
+	0x00, 0xd8, 0x21, 0x00, 0xeb, 0x4d, 0x00, 0xfe, 0xfc, 0x00, 0xad, 0x35,
+	0x00, 0x39, 0xc7, 0x09, 0x21, 0x04, 0x00, 0x5a, 0xcb, 0x00, 0xe6, 0xfc,
+	0x00, 0xe1, 0xa7, 0x00, 0xd8, 0x20, 0x08, 0xd8, 0x00, 0x00, 0xd8, 0x61,
+	0x00, 0xf4, 0x71, 0x00, 0xff, 0x1c, 0x00, 0xec, 0x31, 0x00, 0xd8, 0x41,
+	0x08, 0xd8, 0x00, 0x00, 0xd8, 0x21, 0x00, 0xeb, 0x4d, 0x00, 0xfe, 0xfc,
+	0x00, 0xad, 0x35, 0x00, 0x39, 0xc7, 0x09, 0x21, 0x04, 0x00, 0x5a, 0xeb,
+	0x00, 0xe7, 0x1c, 0x00, 0xe1, 0xa7, 0x00, 0xd8, 0x20, 0x08, 0xd8, 0x00,
+	0x00, 0xd8, 0x61, 0x00, 0xf4, 0x71, 0x00, 0xff, 0x1c, 0x00, 0xec, 0x31,
+	0x00, 0xd8, 0x41, 0x08, 0xd8, 0x00, 0x00, 0xd8, 0x21, 0x00, 0xeb, 0x4d,
+	0x00, 0xfe, 0xfc, 0x00, 0xad, 0x35, 0x00, 0x39, 0xc7, 0x08, 0x21, 0x04,
+	0x00, 0x29, 0x45, 0x00, 0x7b, 0xaf, 0x00, 0xf7, 0x9e, 0x00, 0xe1, 0xc7,
+	0x00, 0xd8, 0x20, 0x08, 0xd8, 0x00, 0x00, 0xd8, 0x61, 0x00, 0xf4, 0x72,
+	0x00, 0xff, 0x3c, 0x00, 0xf4, 0x51, 0x00, 0xd8, 0x41, 0x08, 0xd8, 0x00,
+	0x00, 0xd8, 0x21, 0x00, 0xeb, 0x4d, 0x00, 0xff, 0x1c, 0x00, 0xb5, 0x75,
+	0x00, 0x42, 0x08, 0x07, 0x21, 0x04, 0x00, 0x21, 0x25, 0x00, 0x52, 0xab,
+	0x00, 0xbd, 0xb7, 0x00, 0xff, 0xdf, 0x00, 0xeb, 0xcf, 0x00, 0xe1, 0x86,
+	0x08, 0xe1, 0x45, 0x00, 0xe1, 0xe7, 0x00, 0xf5, 0x96, 0x00, 0xff, 0x7e,
+	0x00, 0xf5, 0x55, 0x00, 0xe1, 0xe8, 0x08, 0xe1, 0x45, 0x00, 0xe1, 0xa6,
+	0x00, 0xf4, 0x92, 0x00, 0xff, 0x7e, 0x00, 0xd6, 0x9a, 0x00, 0x7b, 0xaf,
+	0x00, 0x4a, 0x49, 0x05, 0x42, 0x08, 0x00, 0x4a, 0x49, 0x00, 0x6b, 0x4d,
+	0x00, 0xb5, 0x96, 0x00, 0xef, 0x5d, 0x00, 0xff, 0xff, 0x00, 0xfe, 0xdb,
+	0x00, 0xfd, 0xd7, 0x08, 0xf5, 0x76, 0x00, 0xfd, 0xf8, 0x00, 0xff, 0x5d,
+	0x00, 0xff, 0xdf, 0x00, 0xff, 0x3c, 0x00, 0xfe, 0x18, 0x00, 0xf5, 0x96,
+	0x06, 0xf5, 0x76, 0x00, 0xf5, 0x96, 0x00, 0xf5, 0xd7, 0x00, 0xfe, 0xfc,
+	0x00, 0xff, 0xff, 0x00, 0xf7, 0xbf, 0x00, 0xde, 0xdb, 0x00, 0xc5, 0xf8,
+	0x05, 0xbd, 0xd7, 0x00, 0xc6, 0x18, 0x00, 0xde, 0xdb, 0x00, 0xf7, 0x9e,
+	0x01, 0xff, 0xff,
+};
+
+static const struct st7735s_splash st7735s_splash = {
+	.width = 42,
+	.height = 43,
+	.bg = 0x0000,
+	.rle = st7735s_splash_rle,
+	.rle_len = sizeof(st7735s_splash_rle),
+};
+
+__weak const struct st7735s_splash *st7735s_boot_splash(const struct device *dev)
+{
+	ARG_UNUSED(dev);
+
+	return &st7735s_splash;
+}
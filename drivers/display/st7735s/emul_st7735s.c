@@ -0,0 +1,357 @@
+/*
+ * Copyright (c) 2024 kristosb
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#define DT_DRV_COMPAT sitronix_st7735s
+
+#include <app/drivers/display/display_st7735s.h>
+#include <app/drivers/display/emul_st7735s.h>
+
+#include <zephyr/device.h>
+#include <zephyr/drivers/emul.h>
+#include <zephyr/drivers/gpio.h>
+#include <zephyr/drivers/gpio/gpio_emul.h>
+#include <zephyr/drivers/spi.h>
+#include <zephyr/drivers/spi_emul.h>
+#include <zephyr/sys/byteorder.h>
+#include <zephyr/sys/printk.h>
+#include <zephyr/sys/util.h>
+
+#include <string.h>
+
+#include <zephyr/logging/log.h>
+LOG_MODULE_REGISTER(emul_st7735s, CONFIG_DISPLAY_LOG_LEVEL);
+
+#define ST7735S_EMUL_NO_CMD 0xff
+
+struct st7735s_emul_cfg {
+	struct gpio_dt_spec cmd_data;
+};
+
+struct st7735s_emul_data {
+	uint16_t ram[ST7735S_RAM_HEIGHT][ST7735S_RAM_WIDTH];
+	struct st7735s_emul_stats stats;
+	/* Commands since the last stats reset, the first ones if more */
+	uint8_t cmd_log[ST7735S_EMUL_CMD_LOG_SIZE];
+	size_t cmd_log_len;
+	/* Command being decoded and its parameters */
+	uint8_t cmd;
+	uint8_t params[4];
+	uint8_t param_cnt;
+	/* Controller registers */
+	struct st7735s_emul_modes modes;
+	uint16_t xs;
+	uint16_t xe;
+	uint16_t ys;
+	uint16_t ye;
+	/* RAMWR address counter and pixel bytes not complete yet */
+	uint16_t col;
+	uint16_t row;
+	uint8_t partial[3];
+	uint8_t partial_cnt;
+	int last_dc;
+};
+
+static bool st7735s_emul_is_cmd(const struct emul *target)
+{
+	const struct st7735s_emul_cfg *cfg = target->cfg;
+	int level = gpio_emul_output_get(cfg->cmd_data.port, cfg->cmd_data.pin);
+
+	if (cfg->cmd_data.dt_flags & GPIO_ACTIVE_LOW) {
+		level = !level;
+	}
+
+	return level != 0;
+}
+
+/*
+ * Map the address counter onto physical frame memory the way MADCTL does:
+ * exchange rows and columns first (MV), then mirror columns (MX) and rows
+ * (MY).
+ */
+static void st7735s_emul_store(struct st7735s_emul_data *data, uint16_t pixel)
+{
+	uint16_t a = data->col;
+	uint16_t b = data->row;
+
+	if (data->modes.madctl & ST7735S_MADCTL_MV) {
+		a = data->row;
+		b = data->col;
+	}
+
+	if (data->modes.madctl & ST7735S_MADCTL_MX) {
+		a = ST7735S_RAM_WIDTH - 1 - a;
+	}
+
+	if (data->modes.madctl & ST7735S_MADCTL_MY) {
+		b = ST7735S_RAM_HEIGHT - 1 - b;
+	}
+
+	if (a < ST7735S_RAM_WIDTH && b < ST7735S_RAM_HEIGHT) {
+		data->ram[b][a] = pixel;
+	}
+
+	data->stats.pixels++;
+
+	if (data->col < data->xe) {
+		data->col++;
+		return;
+	}
+
+	data->col = data->xs;
+	data->row = (data->row < data->ye) ? data->row + 1 : data->ys;
+}
+
+static uint16_t st7735s_emul_rgb444_to_565(uint16_t c)
+{
+	uint16_t r = (c >> 8) & 0x0f;
+	uint16_t g = (c >> 4) & 0x0f;
+	uint16_t b = c & 0x0f;
+
+	return ((r << 1 | r >> 3) << 11) | ((g << 2 | g >> 2) << 5) |
+	       (b << 1 | b >> 3);
+}
+
+static void st7735s_emul_pixel_byte(struct st7735s_emul_data *data,
+				    uint8_t byte)
+{
+	data->partial[data->partial_cnt++] = byte;
+
+	if ((data->modes.colmod & ST7735S_COLMOD_IFPF_MASK) ==
+	    ST7735S_COLMOD_12BIT) {
+		if (data->partial_cnt < 3) {
+			return;
+		}
+
+		st7735s_emul_store(data, st7735s_emul_rgb444_to_565(
+			(data->partial[0] << 4) | (data->partial[1] >> 4)));
+		st7735s_emul_store(data, st7735s_emul_rgb444_to_565(
+			((data->partial[1] & 0x0f) << 8) | data->partial[2]));
+	} else {
+		if (data->partial_cnt < 2) {
+			return;
+		}
+
+		st7735s_emul_store(data, sys_get_be16(data->partial));
+	}
+
+	data->partial_cnt = 0;
+}
+
+static void st7735s_emul_command(struct st7735s_emul_data *data, uint8_t cmd)
+{
+	data->cmd = cmd;
+	data->param_cnt = 0;
+	data->partial_cnt = 0;
+
+	if (data->cmd_log_len < sizeof(data->cmd_log)) {
+		data->cmd_log[data->cmd_log_len++] = cmd;
+	}
+
+	switch (cmd) {
+	case ST7735S_CMD_SW_RESET:
+		memset(&data->modes, 0, sizeof(data->modes));
+		data->modes.colmod = ST7735S_COLMOD_18BIT;
+		data->xs = 0;
+		data->xe = ST7735S_RAM_WIDTH - 1;
+		data->ys = 0;
+		data->ye = ST7735S_RAM_HEIGHT - 1;
+		break;
+	case ST7735S_CMD_RAMWR:
+		data->col = data->xs;
+		data->row = data->ys;
+		break;
+	case ST7735S_CMD_RASET:
+		data->stats.windows++;
+		break;
+	case ST7735S_CMD_PTLON:
+	case ST7735S_CMD_NORON:
+		data->modes.partial = (cmd == ST7735S_CMD_PTLON);
+		break;
+	case ST7735S_CMD_IDMON:
+	case ST7735S_CMD_IDMOFF:
+		data->modes.idle = (cmd == ST7735S_CMD_IDMON);
+		break;
+	case ST7735S_CMD_INV_ON:
+	case ST7735S_CMD_INV_OFF:
+		data->modes.inverted = (cmd == ST7735S_CMD_INV_ON);
+		break;
+	default:
+		break;
+	}
+}
+
+static void st7735s_emul_param(struct st7735s_emul_data *data, uint8_t byte)
+{
+	if (data->cmd == ST7735S_CMD_RAMWR) {
+		data->stats.pixel_bytes++;
+		st7735s_emul_pixel_byte(data, byte);
+		return;
+	}
+
+	data->stats.param_bytes++;
+
+	if (data->param_cnt < sizeof(data->params)) {
+		data->params[data->param_cnt] = byte;
+	}
+	data->param_cnt++;
+
+	switch (data->cmd) {
+	case ST7735S_CMD_MADCTL:
+		data->modes.madctl = byte;
+		break;
+	case ST7735S_CMD_COLMOD:
+		data->modes.colmod = byte;
+		break;
+	case ST7735S_CMD_CASET:
+		if (data->param_cnt == 4) {
+			data->xs = sys_get_be16(&data->params[0]);
+			data->xe = sys_get_be16(&data->params[2]);
+		}
+		break;
+	case ST7735S_CMD_RASET:
+		if (data->param_cnt == 4) {
+			data->ys = sys_get_be16(&data->params[0]);
+			data->ye = sys_get_be16(&data->params[2]);
+		}
+		break;
+	default:
+		break;
+	}
+}
+
+static int st7735s_emul_io(const struct emul *target,
+			   const struct spi_config *config,
+			   const struct spi_buf_set *tx_bufs,
+			   const struct spi_buf_set *rx_bufs)
+{
+	struct st7735s_emul_data *data = target->data;
+	int is_cmd = st7735s_emul_is_cmd(target);
+
+	ARG_UNUSED(config);
+	ARG_UNUSED(rx_bufs);
+
+	data->stats.transactions++;
+	if (data->last_dc >= 0 && data->last_dc != is_cmd) {
+		data->stats.dc_toggles++;
+	}
+	data->last_dc = is_cmd;
+
+	if (tx_bufs == NULL) {
+		return 0;
+	}
+
+	for (size_t i = 0; i < tx_bufs->count; i++) {
+		const struct spi_buf *buf = &tx_bufs->buffers[i];
+		const uint8_t *p = buf->buf;
+
+		for (size_t j = 0; j < buf->len; j++) {
+			if (is_cmd) {
+				data->stats.cmd_bytes++;
+				st7735s_emul_command(data, p[j]);
+			} else {
+				st7735s_emul_param(data, p[j]);
+			}
+		}
+	}
+
+	return 0;
+}
+
+void st7735s_emul_get_stats(const struct emul *target,
+			    struct st7735s_emul_stats *stats)
+{
+	struct st7735s_emul_data *data = target->data;
+
+	*stats = data->stats;
+}
+
+void st7735s_emul_reset_stats(const struct emul *target)
+{
+	struct st7735s_emul_data *data = target->data;
+
+	memset(&data->stats, 0, sizeof(data->stats));
+	data->cmd_log_len = 0;
+	data->last_dc = -1;
+}
+
+size_t st7735s_emul_get_cmd_log(const struct emul *target, uint8_t *cmds,
+				size_t size)
+{
+	struct st7735s_emul_data *data = target->data;
+	size_t len = MIN(size, data->cmd_log_len);
+
+	memcpy(cmds, data->cmd_log, len);
+
+	return len;
+}
+
+void st7735s_emul_get_modes(const struct emul *target,
+			    struct st7735s_emul_modes *modes)
+{
+	struct st7735s_emul_data *data = target->data;
+
+	*modes = data->modes;
+}
+
+uint16_t st7735s_emul_get_pixel(const struct emul *target, uint16_t x,
+				uint16_t y)
+{
+	struct st7735s_emul_data *data = target->data;
+
+	if (x >= ST7735S_RAM_WIDTH || y >= ST7735S_RAM_HEIGHT) {
+		return 0;
+	}
+
+	return data->ram[y][x];
+}
+
+void st7735s_emul_dump_frame(const struct emul *target, uint16_t x, uint16_t y,
+			     uint16_t width, uint16_t height)
+{
+	printk("P3\n%u %u\n255\n", width, height);
+
+	for (uint16_t row = y; row < y + height; row++) {
+		for (uint16_t col = x; col < x + width; col++) {
+			uint16_t c = st7735s_emul_get_pixel(target, col, row);
+
+			printk("%u %u %u ", ((c >> 11) & 0x1f) << 3,
+			       ((c >> 5) & 0x3f) << 2, (c & 0x1f) << 3);
+		}
+		printk("\n");
+	}
+}
+
+static int st7735s_emul_init(const struct emul *target,
+			     const struct device *parent)
+{
+	struct st7735s_emul_data *data = target->data;
+
+	ARG_UNUSED(parent);
+
+	memset(data->ram, 0, sizeof(data->ram));
+	st7735s_emul_command(data, ST7735S_CMD_SW_RESET);
+	data->cmd = ST7735S_EMUL_NO_CMD;
+	st7735s_emul_reset_stats(target);
+
+	return 0;
+}
+
+static struct spi_emul_api st7735s_emul_api = {
+	.io = st7735s_emul_io,
+};
+
+#define ST7735S_EMUL(inst)							\
+	static const struct st7735s_emul_cfg st7735s_emul_cfg_##inst = {	\
+		.cmd_data = GPIO_DT_SPEC_INST_GET(inst, cmd_data_gpios),	\
+	};									\
+										\
+	static struct st7735s_emul_data st7735s_emul_data_##inst;		\
+										\
+	EMUL_DT_INST_DEFINE(inst, st7735s_emul_init,				\
+			    &st7735s_emul_data_##inst,				\
+			    &st7735s_emul_cfg_##inst, &st7735s_emul_api, NULL);
+
+DT_INST_FOREACH_STATUS_OKAY(ST7735S_EMUL)
@@ -7,6 +7,8 @@
 #define ST7735S_DISPLAY_DRIVER_H__
 
 #include <zephyr/kernel.h>
+#include <zephyr/device.h>
+#include <zephyr/drivers/display.h>
 
 #define ST7735S_CMD_SW_RESET            0x01
 #define ST7735S_CMD_RDDID               0x04
@@ -69,8 +71,243 @@
 #define ST7735S_CMD_GAMCTRN1            0xE1
 
 /* CMD_MADCTL bits */
+#define ST7735S_MADCTL_MY                       0x80
+#define ST7735S_MADCTL_MX                       0x40
+#define ST7735S_MADCTL_MV                       0x20
+#define ST7735S_MADCTL_ML                       0x10
 #define ST7735S_MADCTL_RBG                      0x00
 #define ST7735S_MADCTL_BGR                      0x08
+#define ST7735S_MADCTL_MH                       0x04
 
+/* CMD_COLMOD interface pixel formats */
+#define ST7735S_COLMOD_IFPF_MASK                0x07
+#define ST7735S_COLMOD_12BIT                    0x03
+#define ST7735S_COLMOD_16BIT                    0x05
+#define ST7735S_COLMOD_18BIT                    0x06
+
+/* Frame memory size (GM = 00, 132 x 162) */
+#define ST7735S_RAM_WIDTH                       132
+#define ST7735S_RAM_HEIGHT                      162
+
+/**
+ * @brief Invert the colors shown by the panel.
+ *
+ * Switches between INVON and INVOFF relative to the devicetree
+ * inversion-on setting. Frame memory is not touched, so this is a cheap
+ * way to flip a dark theme into a light one. The mirror-displays are
+ * inverted along.
+ *
+ * @param dev ST7735S device.
+ * @param invert true to show inverted colors.
+ *
+ * @retval 0 on success, negative errno code on bus failure.
+ */
+int st7735s_set_inversion(const struct device *dev, bool invert);
+
+/**
+ * @brief Select the gamma correction set.
+ *
+ * The mirror-displays switch to their own set of the same kind.
+ *
+ * @param dev ST7735S device.
+ * @param alternate true for the gamctrp1-alt/gamctrn1-alt set, false for
+ *                  the default gamctrp1/gamctrn1 set.
+ *
+ * @retval 0 on success.
+ * @retval -ENOTSUP if this panel or a mirror has no alternate set in
+ *                  devicetree.
+ */
+int st7735s_set_gamma(const struct device *dev, bool alternate);
+
+/**
+ * @brief Set the rows scanned in partial mode.
+ *
+ * Rows are frame memory rows (gate lines), 0 to ST7735S_RAM_HEIGHT - 1,
+ * regardless of the orientation set through MADCTL. Rows outside of the
+ * area show the non-display color while partial mode is on. The area is
+ * set on the mirror-displays too.
+ *
+ * @param dev ST7735S device.
+ * @param start_row First scanned row.
+ * @param end_row Last scanned row.
+ *
+ * @retval 0 on success.
+ * @retval -EINVAL if the rows are out of order or out of range.
+ */
+int st7735s_set_partial_area(const struct device *dev, uint16_t start_row,
+			     uint16_t end_row);
+
+/**
+ * @brief Switch between partial (PTLON) and normal (NORON) mode.
+ *
+ * The mirror-displays switch along.
+ *
+ * @param dev ST7735S device.
+ * @param enable true to scan only the partial area.
+ *
+ * @retval 0 on success.
+ * @retval -EINVAL if no partial area is set.
+ */
+int st7735s_set_partial_mode(const struct device *dev, bool enable);
+
+/**
+ * @brief Switch 8-color idle mode (IDMON/IDMOFF).
+ *
+ * In idle mode only the most significant bit of every color channel is
+ * shown, which is enough for monochrome symbology. The mirror-displays
+ * switch along.
+ *
+ * @param dev ST7735S device.
+ * @param enable true to enter idle mode.
+ *
+ * @retval 0 on success, negative errno code on bus failure.
+ */
+int st7735s_set_idle_mode(const struct device *dev, bool enable);
+
+/**
+ * @brief Choose the modes entered automatically while the display is static.
+ *
+ * After CONFIG_ST7735S_STATIC_TIMEOUT_MS without writes the panel enters
+ * the selected modes, the next write leaves them again. The
+ * mirror-displays get the same modes and time out on their own.
+ *
+ * @param dev ST7735S device.
+ * @param partial Enter partial mode, needs a partial area.
+ * @param idle Enter idle mode.
+ *
+ * @retval 0 on success.
+ * @retval -ENOTSUP if CONFIG_ST7735S_STATIC_TIMEOUT_MS is 0.
+ */
+int st7735s_set_static_modes(const struct device *dev, bool partial, bool idle);
+
+/** One panel's part of an interleaved write */
+struct st7735s_write_req {
+	/** ST7735S device */
+	const struct device *dev;
+	/** Window position, as for display_write() */
+	uint16_t x;
+	uint16_t y;
+	/** Pixel buffer and its layout */
+	const struct display_buffer_descriptor *desc;
+	const void *buf;
+};
+
+/**
+ * @brief Write to several panels sharing a bus, taking turns.
+ *
+ * The windows are sent in chunks of CONFIG_ST7735S_INTERLEAVE_ROWS rows,
+ * alternating between the panels, so neither panel waits for a full
+ * flush of the other one. Requests may share a buffer, which is how the
+ * panels listed in mirror-displays are fed without rendering twice.
+ * With CONFIG_ST7735S_FRAME_SYNC the set waits once, for the frame start
+ * of the first panel.
+ *
+ * @param reqs Write requests, at most one per panel.
+ * @param count Number of requests.
+ *
+ * @retval 0 on success, negative errno code on bus failure.
+ */
+int st7735s_write_interleaved(const struct st7735s_write_req *reqs,
+			      size_t count);
+
+/**
+ * @brief Mark the end of a frame made of several writes.
+ *
+ * With CONFIG_ST7735S_FRAME_SYNC every write waits for the panel frame
+ * start by default, or on a panel without TE line until a frame period
+ * has passed since the previous frame started. Once this is called, only the first write after each
+ * call waits and the following ones go out right away, so a frame flushed
+ * as several areas costs one wait rather than one per area. Call it after
+ * the last area of every frame has been written, e.g. from the LVGL
+ * monitor callback.
+ *
+ * @param dev ST7735S device, the first panel for interleaved writes.
+ *
+ * @retval 0 on success.
+ * @retval -ENOTSUP if CONFIG_ST7735S_FRAME_SYNC is disabled.
+ */
+int st7735s_frame_done(const struct device *dev);
+
+/**
+ * @brief Run length encoded image shown while the system boots.
+ *
+ * The image is centered on the panel, the rest of the panel is filled
+ * with @p bg. Pixels are stored as (run length - 1, RGB565 big endian)
+ * triplets, see scripts/gen_st7735s_splash.py.
+ */
+struct st7735s_splash {
+	/** Image size, at most the panel size */
+	uint16_t width;
+	uint16_t height;
+	/** RGB565 fill around the image */
+	uint16_t bg;
+	/** Encoded pixels, row by row */
+	const uint8_t *rle;
+	size_t rle_len;
+};
+
+/**
+ * @brief Boot splash hook.
+ *
+ * Called with CONFIG_ST7735S_BOOT_SPLASH while the panel is brought out
+ * of sleep, before the display is switched on. The default, weak
+ * implementation returns the LVGL logo; applications may override it,
+ * e.g. to show the last HUD frame saved to flash.
+ *
+ * @param dev ST7735S device.
+ *
+ * @return Splash to stream to frame memory, NULL for none.
+ */
+const struct st7735s_splash *st7735s_boot_splash(const struct device *dev);
+
+/** Flush latency histogram buckets, see struct st7735s_stats */
+#define ST7735S_STATS_HIST_BUCKETS 8
+
+/**
+ * @brief SPI side cost of the display writes.
+ *
+ * Collected with CONFIG_ST7735S_STATS. Latency is measured per
+ * display_write() call, including the wait for the panel refresh with
+ * CONFIG_ST7735S_FRAME_SYNC.
+ */
+struct st7735s_stats {
+	/** Bytes sent, commands, parameters and pixels */
+	uint64_t bytes;
+	/** SPI transfers */
+	uint32_t transactions;
+	/** CASET/RASET windows set */
+	uint32_t windows;
+	/** display_write() calls */
+	uint32_t writes;
+	/** Shortest write */
+	uint32_t latency_min_us;
+	/** Longest write */
+	uint32_t latency_max_us;
+	/** Sum of all write latencies, divide by writes for the average */
+	uint64_t latency_sum_us;
+	/** Writes taking less than 1, 2, 4, ... 64 ms, the last bucket more */
+	uint32_t latency_hist[ST7735S_STATS_HIST_BUCKETS];
+};
+
+/**
+ * @brief Read the write statistics.
+ *
+ * @param dev ST7735S device.
+ * @param stats Destination for the statistics.
+ *
+ * @retval 0 on success.
+ * @retval -ENOTSUP if CONFIG_ST7735S_STATS is disabled.
+ */
+int st7735s_get_stats(const struct device *dev, struct st7735s_stats *stats);
+
+/**
+ * @brief Clear the write statistics.
+ *
+ * @param dev ST7735S device.
+ *
+ * @retval 0 on success.
+ * @retval -ENOTSUP if CONFIG_ST7735S_STATS is disabled.
+ */
+int st7735s_reset_stats(const struct device *dev);
 
 #endif  /* ST7735S_DISPLAY_DRIVER_H__ */
@@ -0,0 +1,126 @@
+/*
+ * Copyright (c) 2024 kristosb
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+#ifndef ST7735S_DISPLAY_EMUL_H__
+#define ST7735S_DISPLAY_EMUL_H__
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <zephyr/drivers/emul.h>
+
+/** Commands kept by the emulator between two stats resets */
+#define ST7735S_EMUL_CMD_LOG_SIZE 32
+
+/**
+ * @brief Bus traffic seen by an emulated ST7735S.
+ *
+ * All counters accumulate until st7735s_emul_reset_stats() is called, so a
+ * test brackets one frame (or one flush) with a reset and a read.
+ */
+struct st7735s_emul_stats {
+	/** SPI transactions (chip select assertions) */
+	uint32_t transactions;
+	/** Bytes sent with D/C in command state */
+	uint32_t cmd_bytes;
+	/** Command parameter bytes, everything but RAMWR payload */
+	uint32_t param_bytes;
+	/** RAMWR payload bytes */
+	uint32_t pixel_bytes;
+	/** Pixels stored into frame memory */
+	uint32_t pixels;
+	/** D/C line changes between transactions */
+	uint32_t dc_toggles;
+	/** CASET/RASET pairs, i.e. windows opened */
+	uint32_t windows;
+};
+
+/**
+ * @brief Controller state as set through the bus.
+ */
+struct st7735s_emul_modes {
+	/** Last MADCTL parameter */
+	uint8_t madctl;
+	/** Last COLMOD parameter */
+	uint8_t colmod;
+	/** Partial mode (PTLON) rather than normal mode (NORON) */
+	bool partial;
+	/** 8-color idle mode (IDMON) */
+	bool idle;
+	/** Display inversion (INVON) */
+	bool inverted;
+};
+
+/**
+ * @brief Read the traffic counters.
+ *
+ * @param target Emulator instance.
+ * @param stats Destination for the counters.
+ */
+void st7735s_emul_get_stats(const struct emul *target,
+			    struct st7735s_emul_stats *stats);
+
+/**
+ * @brief Clear the traffic counters and the command log.
+ *
+ * @param target Emulator instance.
+ */
+void st7735s_emul_reset_stats(const struct emul *target);
+
+/**
+ * @brief Read the commands received since the last stats reset.
+ *
+ * Only the first ST7735S_EMUL_CMD_LOG_SIZE commands are kept, which is
+ * enough to check the command sequence of a mode change or a write.
+ *
+ * @param target Emulator instance.
+ * @param cmds Destination for the command bytes, in bus order.
+ * @param size Size of @p cmds.
+ *
+ * @return Number of commands stored into @p cmds.
+ */
+size_t st7735s_emul_get_cmd_log(const struct emul *target, uint8_t *cmds,
+				size_t size);
+
+/**
+ * @brief Read the controller modes.
+ *
+ * @param target Emulator instance.
+ * @param modes Destination for the modes.
+ */
+void st7735s_emul_get_modes(const struct emul *target,
+			    struct st7735s_emul_modes *modes);
+
+/**
+ * @brief Read one pixel of the emulated frame memory.
+ *
+ * Coordinates are physical frame memory coordinates (MADCTL = 0), the value
+ * is RGB565 as decoded from the bus, 12-bit pixels are expanded.
+ *
+ * @param target Emulator instance.
+ * @param x Frame memory column.
+ * @param y Frame memory row.
+ *
+ * @return Pixel value, 0 for coordinates outside of frame memory.
+ */
+uint16_t st7735s_emul_get_pixel(const struct emul *target, uint16_t x,
+				uint16_t y);
+
+/**
+ * @brief Dump a frame memory region as a plain text PPM image.
+ *
+ * The image goes to the console, which on native_sim makes it easy to
+ * capture frames from a test run and look at them on the host.
+ *
+ * @param target Emulator instance.
+ * @param x First frame memory column.
+ * @param y First frame memory row.
+ * @param width Region width.
+ * @param height Region height.
+ */
+void st7735s_emul_dump_frame(const struct emul *target, uint16_t x, uint16_t y,
+			     uint16_t width, uint16_t height);
+
+#endif  /* ST7735S_DISPLAY_EMUL_H__ */
@@ -0,0 +1,148 @@
+/*
+ * Copyright (c) 2024 kristosb
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef APP_LIB_HUD_DRAW_H_
+#define APP_LIB_HUD_DRAW_H_
+
+#include <stddef.h>
+#include <stdint.h>
+
+/**
+ * @defgroup lib_hud_draw HUD drawing primitives
+ * @ingroup lib
+ * @{
+ *
+ * @brief Span fills on RGB565 buffers.
+ *
+ * Plain loops over rows of 16 bit pixels, for renderers that own their
+ * buffer: the LVGL draw buffer in a DRAW_MAIN handler or a hud_scanline
+ * band. Colors are stored as given, in whatever byte order the buffer
+ * uses.
+ */
+
+/** Sky/ground split of an artificial horizon */
+struct hud_horizon {
+	/** Rotation center, in the coordinates of the buffer area */
+	int16_t cx;
+	int16_t cy;
+	/** Horizon distance below the center before roll, pixels */
+	int16_t offset;
+	/** Roll sine and cosine, scaled by 32768 */
+	int32_t sin;
+	int32_t cos;
+	/** Fill above and below the horizon */
+	uint16_t sky;
+	uint16_t ground;
+};
+
+/** Pixel formats of struct hud_draw_buf */
+enum hud_draw_format {
+	/** 16 bit pixels */
+	HUD_DRAW_RGB565,
+	/** 1 bit alpha, MSB first, rows padded to whole bytes */
+	HUD_DRAW_A1,
+};
+
+/** Pixel buffer to draw into */
+struct hud_draw_buf {
+	/** First pixel */
+	void *buf;
+	/** Pixels from one row to the next */
+	size_t stride;
+	/** Coordinates of the first pixel */
+	int16_t x0;
+	int16_t y0;
+	/** Area size, drawing is clipped to it */
+	uint16_t width;
+	uint16_t height;
+	/** Pixel format, see enum hud_draw_format */
+	uint8_t format;
+};
+
+/**
+ * @brief Fill pixels with one color, two pixels per 32 bit store.
+ *
+ * @param dst First pixel, 2 byte aligned.
+ * @param count Number of pixels.
+ * @param color Pixel value.
+ */
+void hud_draw_fill16(uint16_t *dst, size_t count, uint16_t color);
+
+/**
+ * @brief Fill an area with sky and ground, split by a rotated horizon.
+ *
+ * A pixel is ground if, rotated back by the roll angle around (cx, cy),
+ * it lies more than offset pixels below the center. The edge column of
+ * every row is stepped exactly in integers, without a division per row,
+ * and each row is filled with at most two hud_draw_fill16() spans.
+ *
+ * @param buf First pixel of the area.
+ * @param stride Pixels from one row of @p buf to the next.
+ * @param x0 Column of the first pixel.
+ * @param y0 Row of the first pixel.
+ * @param width Area width.
+ * @param height Area height.
+ * @param hz Horizon.
+ */
+void hud_draw_horizon(uint16_t *buf, size_t stride, int16_t x0, int16_t y0,
+		      uint16_t width, uint16_t height,
+		      const struct hud_horizon *hz);
+
+/**
+ * @brief Fill a rectangle, clipped to the buffer.
+ *
+ * @param dst Buffer.
+ * @param x1 Left column.
+ * @param y1 Top row.
+ * @param x2 Right column, inclusive.
+ * @param y2 Bottom row, inclusive.
+ * @param color Pixel value, for HUD_DRAW_A1 any non zero value sets bits.
+ */
+void hud_draw_rect(const struct hud_draw_buf *dst, int16_t x1, int16_t y1,
+		   int16_t x2, int16_t y2, uint16_t color);
+
+/**
+ * @brief Draw a solid line without anti-aliasing.
+ *
+ * Horizontal and vertical lines cover the same pixels as lv_draw_line()
+ * does: the end point is excluded and a width of w spans (w - 1) / 2
+ * pixels on one side and the rest on the other. Other lines are stepped
+ * with Bresenham, every run of pixels on one row (or column) is filled as
+ * one rectangle of the line width.
+ *
+ * @param dst Buffer.
+ * @param x1 Start column.
+ * @param y1 Start row.
+ * @param x2 End column.
+ * @param y2 End row.
+ * @param width Line width in pixels.
+ * @param color Pixel value.
+ */
+void hud_draw_line(const struct hud_draw_buf *dst, int16_t x1, int16_t y1,
+		   int16_t x2, int16_t y2, uint8_t width, uint16_t color);
+
+/**
+ * @brief Draw vertical lines sharing the same rows in one pass.
+ *
+ * Covers the pixels of hud_draw_line(dst, xs[i], y1, xs[i], y2 + 1, ...)
+ * for every line, but the rows are clipped once for all lines and every
+ * line once against the columns, instead of once per call.
+ *
+ * @param dst Buffer.
+ * @param xs Columns of the lines.
+ * @param count Number of lines.
+ * @param y1 Top row.
+ * @param y2 Bottom row, inclusive.
+ * @param width Line width in pixels.
+ * @param color Pixel value.
+ */
+void hud_draw_vlines(const struct hud_draw_buf *dst, const int16_t *xs,
+		     size_t count, int16_t y1, int16_t y2, uint8_t width,
+		     uint16_t color);
+
+/** @} */
+
+#endif /* APP_LIB_HUD_DRAW_H_ */
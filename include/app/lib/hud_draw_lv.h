@@ -0,0 +1,54 @@
+/*
+ * Copyright (c) 2024 kristosb
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef APP_LIB_HUD_DRAW_LV_H_
+#define APP_LIB_HUD_DRAW_LV_H_
+
+#include <stdbool.h>
+#include <lvgl.h>
+
+#include <app/lib/hud_draw.h>
+
+/**
+ * @addtogroup lib_hud_draw
+ * @{
+ */
+
+/**
+ * @brief lv_draw_line() replacement for HUD strokes.
+ *
+ * Solid, opaque lines are drawn with hud_draw_line() straight into the
+ * draw buffer of the software renderer, without anti-aliasing. Dashed,
+ * rounded, translucent or masked lines are passed on to lv_draw_line().
+ * Needs LV_COLOR_DEPTH 16.
+ *
+ * @param draw_ctx Draw context of the DRAW_MAIN event.
+ * @param dsc Line descriptor.
+ * @param point1 Start point.
+ * @param point2 End point.
+ */
+void hud_draw_lv_line(lv_draw_ctx_t *draw_ctx, const lv_draw_line_dsc_t *dsc,
+		      const lv_point_t *point1, const lv_point_t *point2);
+
+/**
+ * @brief Describe the clip area of a draw context as a hud_draw buffer.
+ *
+ * For widgets that draw with the hud_draw functions straight into the
+ * draw buffer of the software renderer. Needs LV_COLOR_DEPTH 16.
+ *
+ * @param draw_ctx Draw context of the DRAW_MAIN event.
+ * @param area Area that will be drawn, checked for masks.
+ * @param dst Buffer to fill in.
+ *
+ * @retval true if @p dst can be drawn into.
+ * @retval false if a mask covers @p area and LVGL has to draw.
+ */
+bool hud_draw_lv_buf(lv_draw_ctx_t *draw_ctx, const lv_area_t *area,
+		     struct hud_draw_buf *dst);
+
+/** @} */
+
+#endif /* APP_LIB_HUD_DRAW_LV_H_ */
@@ -0,0 +1,147 @@
+/*
+ * Copyright (c) 2024 kristosb
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef APP_LIB_HUD_SCANLINE_H_
+#define APP_LIB_HUD_SCANLINE_H_
+
+#include <stddef.h>
+#include <stdint.h>
+#include <zephyr/device.h>
+#include <zephyr/drivers/display.h>
+#include <zephyr/kernel.h>
+
+/**
+ * @defgroup lib_hud_scanline HUD scanline renderer
+ * @ingroup lib
+ * @{
+ *
+ * @brief Framebuffer-less renderer for HUD symbology.
+ *
+ * The scene is a list of primitives (lines, ticks, text strips). It is
+ * rasterized band by band, CONFIG_HUD_SCANLINE_BAND_ROWS rows at a time,
+ * into two small band buffers: while one is sent with display_write() from
+ * a writer work queue, the next band is rendered into the other. No frame
+ * or partial frame is ever held in RAM.
+ */
+
+/** Primitive kinds */
+enum hud_sl_type {
+	/** Line from (x0, y0) to (x1, y1), width in pixels */
+	HUD_SL_LINE,
+	/** Text at (x0, y0) top left, 5x7 glyphs scaled by width */
+	HUD_SL_TEXT,
+};
+
+/** One primitive of a scene */
+struct hud_sl_prim {
+	/** Primitive kind */
+	uint8_t type;
+	/** Line width, or text scale */
+	uint8_t width;
+	/** Color in panel byte order, see hud_sl_color() */
+	uint16_t color;
+	int16_t x0;
+	int16_t y0;
+	int16_t x1;
+	int16_t y1;
+	/** Text, digits, '-', '.', ' ' and N E S W */
+	const char *text;
+};
+
+/** Line primitive initializer */
+#define HUD_SL_LINE(_x0, _y0, _x1, _y1, _w, _c)				\
+	{ .type = HUD_SL_LINE, .width = (_w), .color = (_c),		\
+	  .x0 = (_x0), .y0 = (_y0), .x1 = (_x1), .y1 = (_y1) }
+
+/** Text primitive initializer */
+#define HUD_SL_TEXT(_x, _y, _scale, _c, _txt)				\
+	{ .type = HUD_SL_TEXT, .width = (_scale), .color = (_c),	\
+	  .x0 = (_x), .y0 = (_y), .text = (_txt) }
+
+/** Renderer state */
+struct hud_sl_ctx {
+	const struct device *display;
+	/** Band buffers, hud_sl_render_band() draws into the first */
+	uint16_t *band[2];
+	/** Display size */
+	uint16_t width;
+	uint16_t height;
+	/** Rows per band, limited by the band buffer */
+	uint16_t rows;
+	/** Background color */
+	uint16_t bg;
+	/** Band write on the writer queue */
+	struct k_work write_work;
+	struct k_sem write_done;
+	struct display_buffer_descriptor write_desc;
+	const uint16_t *write_buf;
+	uint16_t write_y;
+	int write_ret;
+};
+
+/**
+ * @brief Define both band buffers for a display @p width pixels wide.
+ */
+#define HUD_SL_BAND_DEFINE(name, width)					\
+	static uint16_t name[2 * (width) * CONFIG_HUD_SCANLINE_BAND_ROWS]
+
+/**
+ * @brief Convert a color to a pixel value for the panel.
+ *
+ * @param r Red, 0-255.
+ * @param g Green, 0-255.
+ * @param b Blue, 0-255.
+ *
+ * @return RGB565 pixel in the byte order display_write() expects.
+ */
+uint16_t hud_sl_color(uint8_t r, uint8_t g, uint8_t b);
+
+/**
+ * @brief Set up a renderer for a display.
+ *
+ * @param ctx Renderer state.
+ * @param display Display device, RGB565.
+ * @param band Band buffers, split in two halves.
+ * @param band_px Size of @p band in pixels, at least two display rows.
+ *
+ * @retval 0 on success.
+ * @retval -EINVAL if the halves of @p band do not hold a row each.
+ */
+int hud_sl_init(struct hud_sl_ctx *ctx, const struct device *display,
+		uint16_t *band, size_t band_px);
+
+/**
+ * @brief Rasterize the rows [y0, y0 + rows) of a scene into the first band
+ * buffer.
+ *
+ * @param ctx Renderer state.
+ * @param y0 First display row of the band.
+ * @param rows Rows in the band, at most ctx->rows.
+ * @param prims Scene.
+ * @param count Number of primitives.
+ */
+void hud_sl_render_band(const struct hud_sl_ctx *ctx, uint16_t y0,
+			uint16_t rows, const struct hud_sl_prim *prims,
+			size_t count);
+
+/**
+ * @brief Render a scene to the display, band by band.
+ *
+ * Each band is rendered while the previous one is written. Returns once
+ * the last band is written, the scene can be changed then.
+ *
+ * @param ctx Renderer state.
+ * @param prims Scene.
+ * @param count Number of primitives.
+ *
+ * @retval 0 on success, negative errno code from display_write().
+ */
+int hud_sl_render(struct hud_sl_ctx *ctx, const struct hud_sl_prim *prims,
+		  size_t count);
+
+/** @} */
+
+#endif /* APP_LIB_HUD_SCANLINE_H_ */
@@ -97,6 +97,8 @@ lv_obj_t * lv_compass_create(lv_obj_t * parent);
 
 /**
  * Set compass angle. 
+ * Changes within CONFIG_LV_COMPASS_DEADBAND degrees are ignored.
+ * Only the heading readout and, if it moves, the tape band are invalidated.
  * @param obj       pointer the compass object
  * @param angle      value of the angle
  */
@@ -111,6 +113,12 @@ void lv_compass_set_dark_style(lv_obj_t * obj);
  * @param obj      pointer to a scale object
  */
 void lv_compass_set_light_style(lv_obj_t * obj);
+/**
+ * Set the color of the compass lines and labels.
+ * @param obj      pointer to a compass object
+ * @param color    line and label color
+ */
+void lv_compass_set_color(lv_obj_t * obj, lv_color_t color);
 /**
  * Set compass line width.
  * @param obj      pointer to a scale object
@@ -0,0 +1,90 @@
+/*
+MIT License
+
+Copyright (c) 2024 kristosb
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+ */ 
+
+#ifndef APP_LIB_LV_GLYPH_ATLAS_H_
+#define APP_LIB_LV_GLYPH_ATLAS_H_
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include <lv_conf_internal.h>
+
+#include <stdbool.h>
+#include <core/lv_obj.h>
+#include <draw/lv_draw_label.h>
+
+/*********************
+ *      DEFINES
+ *********************/
+
+/**Characters held by the atlas, enough for signed integers. */
+#define LV_GLYPH_ATLAS_CHARS " -0123456789"
+
+/**********************
+ * GLOBAL PROTOTYPES
+ **********************/
+
+/**
+ * Render the atlas for a font, 4 bits per pixel. Widgets call it when they
+ * are created, the atlas is shared, so this only does work for the first
+ * caller or when the font changes.
+ * @param font      font of the labels to draw from the atlas
+ * @return          LV_RES_OK, or LV_RES_INV if the glyphs do not fit in
+ *                  CONFIG_LV_GLYPH_ATLAS_SIZE bytes
+ */
+lv_res_t lv_glyph_atlas_init(const lv_font_t * font);
+
+/**
+ * Draw an integer from the atlas, in place of formatting it and passing it
+ * to lv_draw_label().
+ * @param draw_ctx  draw context of the DRAW_MAIN event
+ * @param dsc       label descriptor, font, color and opacity are used
+ * @param pos       top left corner of the text line
+ * @param value     value to draw
+ * @param pad       put a space in front of values >= 0, so they line up
+ *                  with negative ones
+ * @return          LV_RES_OK, or LV_RES_INV if the atlas does not hold
+ *                  dsc->font and the caller has to draw the label itself
+ */
+lv_res_t lv_glyph_atlas_draw_int(lv_draw_ctx_t * draw_ctx, const lv_draw_label_dsc_t * dsc,
+                                 const lv_point_t * pos, int32_t value, bool pad);
+
+/**
+ * Draw an integer from the atlas into a 1 bit alpha buffer, such as a
+ * LV_IMG_CF_ALPHA_1BIT canvas. Pixels at least half covered are set.
+ * @param buf       pixels, rows of (w + 7) / 8 bytes, MSB first
+ * @param w         buffer width
+ * @param h         buffer height
+ * @param dsc       label descriptor, only the font is used
+ * @param pos       top left corner of the text line
+ * @param value     value to draw
+ * @param pad       as for lv_glyph_atlas_draw_int()
+ * @return          LV_RES_OK, or LV_RES_INV if the atlas does not hold
+ *                  dsc->font
+ */
+lv_res_t lv_glyph_atlas_draw_int_a1(uint8_t * buf, lv_coord_t w, lv_coord_t h,
+                                    const lv_draw_label_dsc_t * dsc,
+                                    const lv_point_t * pos, int32_t value, bool pad);
+
+#endif /*APP_LIB_LV_GLYPH_ATLAS_H_*/
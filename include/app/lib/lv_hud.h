@@ -0,0 +1,97 @@
+/*
+MIT License
+
+Copyright (c) 2024 kristosb
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+ */ 
+
+#ifndef APP_LIB_LV_HUD_H_
+#define APP_LIB_LV_HUD_H_
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include <lv_conf_internal.h>
+
+#include <core/lv_obj.h>
+
+/*********************
+ *      DEFINES
+ *********************/
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+typedef struct {
+    lv_obj_t obj;
+    lv_obj_t * compass;         /**< Hidden child, drawn by the HUD*/
+    lv_obj_t * pitch_ladder;    /**< Hidden child, drawn by the HUD*/
+} lv_hud_t;
+
+extern const lv_obj_class_t lv_hud_class;
+
+/**********************
+ * GLOBAL PROTOTYPES
+ **********************/
+
+/**
+ * Create a HUD object holding a compass and a pitch ladder. Both are drawn
+ * by the HUD in one pass, ladder first and compass on top, and every
+ * update invalidates only the regions the compass and the ladder changed.
+ * @param parent    pointer to an object, it will be the parent of the new HUD
+ * @return          pointer to the created HUD
+ */
+lv_obj_t * lv_hud_create(lv_obj_t * parent);
+
+/*=====================
+ * Setter functions
+ *====================*/
+
+/**
+ * Set heading and attitude, with the dead-bands of the compass and the
+ * pitch ladder.
+ * @param obj       pointer to a HUD object
+ * @param heading   heading in degrees, as for lv_compass_angle()
+ * @param pitch     pitch, as for lv_pitch_ladder_set_angles()
+ * @param roll      roll in 0.1 degrees, as for lv_pitch_ladder_set_angles()
+ */
+void lv_hud_set_attitude(lv_obj_t * obj, int32_t heading, int32_t pitch, int16_t roll);
+
+/*=====================
+ * Getter functions
+ *====================*/
+
+/**
+ * Get the compass, to style it with the lv_compass functions. The HUD is
+ * not invalidated by them, call lv_obj_invalidate() on the HUD after.
+ * @param obj       pointer to a HUD object
+ * @return          the compass
+ */
+lv_obj_t * lv_hud_get_compass(lv_obj_t * obj);
+
+/**
+ * Get the pitch ladder, to style it with the lv_pitch_ladder functions,
+ * see lv_hud_get_compass().
+ * @param obj       pointer to a HUD object
+ * @return          the pitch ladder
+ */
+lv_obj_t * lv_hud_get_pitch_ladder(lv_obj_t * obj);
+
+#endif /*APP_LIB_LV_HUD_H_*/
@@ -71,6 +71,11 @@ LV_EXPORT_CONST_INT(LV_PITCH_LADDER_LABEL_ENABLED_DEFAULT);
 #define LV_PITCH_LADDER_ROLL_TICK_RANGE (4U)
 #define LV_PITCH_LADDER_LABEL_W (16U)
 #define LV_PITCH_LADDER_PITCH_SCALE (10U)
+/* Horizon fill colors of the dark and light styles */
+#define LV_PITCH_LADDER_DARK_SKY lv_color_make(0x00, 0x20, 0x40)
+#define LV_PITCH_LADDER_DARK_GROUND lv_color_make(0x30, 0x18, 0x00)
+#define LV_PITCH_LADDER_LIGHT_SKY lv_color_make(0x80, 0xC0, 0xFF)
+#define LV_PITCH_LADDER_LIGHT_GROUND lv_color_make(0xC0, 0x90, 0x60)
 
 /**********************
  *      TYPEDEFS
@@ -109,9 +114,14 @@ typedef struct {
     int16_t roll_angle;
     uint32_t post_draw          : 1;
     uint32_t widget_draw        : 1;
+    uint32_t update_pending     : 1;    /**< Redraw queued for the next LVGL timer run*/
     lv_draw_label_dsc_t label_dsc;
     lv_draw_line_dsc_t line_dsc;
     lv_color_t bg;
+    lv_color_t sky;         /**< Horizon fill above and below the horizon*/
+    lv_color_t ground;
+    uint8_t * canvas_buf;   /**< Composed ladder, LV_IMG_CF_ALPHA_1BIT*/
+    uint8_t * img_buf;      /**< Rotated image, LV_IMG_CF_TRUE_COLOR_ALPHA*/
 } lv_pitch_ladder_t;
 
 extern const lv_obj_class_t lv_pitch_ladder_class;
@@ -136,6 +146,8 @@ lv_obj_t * lv_pitch_ladder_create(lv_obj_t * parent);
  *====================*/
 /**
  * Set pitch and roll angles for ladder indicator.
+ * The ladder is rendered once before the next refresh with the latest
+ * angles; changes within the configured dead-bands are ignored.
  * @param obj      pointer to a pitch ladder object
  * @param pitch    pitch angle value
  * @param roll     roll angle value
@@ -151,12 +163,27 @@ void lv_pitch_ladder_set_dark_style(lv_obj_t * obj);
  * @param obj      pointer to a pitch ladder object
  */
 void lv_pitch_ladder_set_light_style(lv_obj_t * obj);
+/**
+ * Set the color of the ladder lines and labels.
+ * @param obj      pointer to a pitch ladder object
+ * @param color    line and label color
+ */
+void lv_pitch_ladder_set_color(lv_obj_t * obj, lv_color_t color);
 /**
  * Set pitch ladder line width.
  * @param obj      pointer to a pitch ladder object
  * @param width    line width
  */
 void lv_pitch_ladder_set_line_width(lv_obj_t * obj, lv_coord_t width);
+/**
+ * Set the sky and ground colors of the horizon fill, drawn with
+ * CONFIG_LV_PITCH_LADDER_HORIZON_FILL. On a panel showing inverted
+ * colors pass the negative of the colors to be seen.
+ * @param obj      pointer to a pitch ladder object
+ * @param sky      color above the horizon
+ * @param ground   color below the horizon
+ */
+void lv_pitch_ladder_set_horizon_colors(lv_obj_t * obj, lv_color_t sky, lv_color_t ground);
 /*=====================
  * Getter functions
  *====================*/
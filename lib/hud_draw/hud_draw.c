@@ -0,0 +1,267 @@
+/*
+ * Copyright (c) 2024 kristosb
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <app/lib/hud_draw.h>
+
+#include <stdbool.h>
+#include <stdlib.h>
+#include <zephyr/sys/util.h>
+
+void hud_draw_fill16(uint16_t *dst, size_t count, uint16_t color)
+{
+	uint32_t pair = ((uint32_t)color << 16) | color;
+	uint32_t *word;
+
+	if (count > 0 && ((uintptr_t)dst & 0x2)) {
+		*dst++ = color;
+		count--;
+	}
+
+	word = (uint32_t *)dst;
+	for (; count >= 8; count -= 8) {
+		word[0] = pair;
+		word[1] = pair;
+		word[2] = pair;
+		word[3] = pair;
+		word += 4;
+	}
+	for (; count >= 2; count -= 2) {
+		*word++ = pair;
+	}
+
+	if (count > 0) {
+		*(uint16_t *)word = color;
+	}
+}
+
+/* Division rounding down, d > 0 */
+static int64_t hud_draw_div_floor(int64_t n, int64_t d)
+{
+	return (n >= 0) ? n / d : -((-n + d - 1) / d);
+}
+
+static void hud_draw_row(uint16_t *row, uint16_t width, int32_t split,
+			 uint16_t left, uint16_t right)
+{
+	split = CLAMP(split, 0, (int32_t)width);
+
+	hud_draw_fill16(row, split, left);
+	hud_draw_fill16(row + split, width - split, right);
+}
+
+void hud_draw_horizon(uint16_t *buf, size_t stride, int16_t x0, int16_t y0,
+		      uint16_t width, uint16_t height,
+		      const struct hud_horizon *hz)
+{
+	int64_t h = (int64_t)hz->offset << 15;
+	int64_t s = (hz->sin < 0) ? -(int64_t)hz->sin : hz->sin;
+	int64_t n, c, q, r, qc, rc;
+	uint16_t left, right;
+
+	/*
+	 * Ground where -dx * sin + dy * cos > offset, dx and dy from the
+	 * center. With sin == 0 that depends on the row only.
+	 */
+	if (hz->sin == 0) {
+		for (uint16_t y = 0; y < height; y++) {
+			bool ground = (int64_t)(y0 + y - hz->cy) * hz->cos > h;
+
+			hud_draw_fill16(&buf[y * stride], width,
+					ground ? hz->ground : hz->sky);
+		}
+		return;
+	}
+
+	/*
+	 * Otherwise the edge is at dx = n / s, with the signs folded so that
+	 * s > 0. Keep n / s as quotient and remainder and step both by
+	 * cos / s per row, which stays exact.
+	 */
+	n = (int64_t)(y0 - hz->cy) * hz->cos - h;
+	c = hz->cos;
+	if (hz->sin < 0) {
+		n = -n;
+		c = -c;
+	}
+
+	q = hud_draw_div_floor(n, s);
+	r = n - q * s;
+	qc = hud_draw_div_floor(c, s);
+	rc = c - qc * s;
+
+	left = (hz->sin > 0) ? hz->ground : hz->sky;
+	right = (hz->sin > 0) ? hz->sky : hz->ground;
+
+	for (uint16_t y = 0; y < height; y++) {
+		/* First column right of the edge: ceil(n / s) or floor + 1 */
+		int64_t edge = (hz->sin > 0) ? q + (r != 0) : q + 1;
+
+		hud_draw_row(&buf[y * stride], width,
+			     (int32_t)CLAMP(hz->cx + edge - x0, -1, (int64_t)width + 1),
+			     left, right);
+
+		q += qc;
+		r += rc;
+		if (r >= s) {
+			r -= s;
+			q++;
+		}
+	}
+}
+
+static void hud_draw_bits(uint8_t *row, int32_t xl, int32_t xr)
+{
+	uint8_t *first = &row[xl / 8];
+	uint8_t *last = &row[xr / 8];
+	uint8_t head = 0xff >> (xl & 7);
+	uint8_t tail = 0xff << (7 - (xr & 7));
+
+	if (first == last) {
+		*first |= head & tail;
+		return;
+	}
+
+	*first++ |= head;
+	while (first < last) {
+		*first++ = 0xff;
+	}
+	*last |= tail;
+}
+
+void hud_draw_rect(const struct hud_draw_buf *dst, int16_t x1, int16_t y1,
+		   int16_t x2, int16_t y2, uint16_t color)
+{
+	int32_t xl = MAX((int32_t)x1 - dst->x0, 0);
+	int32_t xr = MIN((int32_t)x2 - dst->x0, (int32_t)dst->width - 1);
+	int32_t yt = MAX((int32_t)y1 - dst->y0, 0);
+	int32_t yb = MIN((int32_t)y2 - dst->y0, (int32_t)dst->height - 1);
+
+	if (xl > xr || yt > yb) {
+		return;
+	}
+
+	for (int32_t y = yt; y <= yb; y++) {
+		if (dst->format == HUD_DRAW_A1) {
+			uint8_t *row = (uint8_t *)dst->buf + y * ((dst->stride + 7) / 8);
+
+			if (color != 0) {
+				hud_draw_bits(row, xl, xr);
+			}
+		} else {
+			uint16_t *row = (uint16_t *)dst->buf + y * dst->stride;
+
+			hud_draw_fill16(row + xl, xr - xl + 1, color);
+		}
+	}
+}
+
+void hud_draw_line(const struct hud_draw_buf *dst, int16_t x1, int16_t y1,
+		   int16_t x2, int16_t y2, uint8_t width, uint16_t color)
+{
+	int32_t half0 = (width - 1) >> 1;
+	int32_t half1 = half0 + ((width - 1) & 1);
+	int32_t dx = abs(x2 - x1);
+	int32_t dy = -abs(y2 - y1);
+	int32_t sx = (x1 < x2) ? 1 : -1;
+	int32_t sy = (y1 < y2) ? 1 : -1;
+	bool steep = -dy > dx;
+	int32_t err = dx + dy;
+	int32_t x = x1;
+	int32_t y = y1;
+	int32_t run = steep ? y1 : x1;
+
+	if (width == 0) {
+		return;
+	}
+
+	/* Same boxes as the horizontal and vertical cases of lv_draw_line() */
+	if (y1 == y2) {
+		hud_draw_rect(dst, MIN(x1, x2), y1 - half1, MAX(x1, x2) - 1,
+			      y1 + half0, color);
+		return;
+	}
+	if (x1 == x2) {
+		hud_draw_rect(dst, x1 - half1, MIN(y1, y2), x1 + half0,
+			      MAX(y1, y2) - 1, color);
+		return;
+	}
+
+	/* Fill a run when the minor coordinate is about to change */
+	while (true) {
+		bool end = (x == x2 && y == y2);
+		int32_t e2 = 2 * err;
+		bool step_minor = steep ? (e2 >= dy) : (e2 <= dx);
+
+		if (end || step_minor) {
+			if (steep) {
+				hud_draw_rect(dst, x - half1, MIN(run, y),
+					      x + half0, MAX(run, y), color);
+			} else {
+				hud_draw_rect(dst, MIN(run, x), y - half1,
+					      MAX(run, x), y + half0, color);
+			}
+		}
+		if (end) {
+			break;
+		}
+
+		if (e2 >= dy) {
+			err += dy;
+			x += sx;
+		}
+		if (e2 <= dx) {
+			err += dx;
+			y += sy;
+		}
+		if (step_minor) {
+			run = steep ? y : x;
+		}
+	}
+}
+
+void hud_draw_vlines(const struct hud_draw_buf *dst, const int16_t *xs,
+		     size_t count, int16_t y1, int16_t y2, uint8_t width,
+		     uint16_t color)
+{
+	int32_t half0 = (width - 1) >> 1;
+	int32_t half1 = half0 + ((width - 1) & 1);
+	int32_t yt = MAX((int32_t)y1 - dst->y0, 0);
+	int32_t yb = MIN((int32_t)y2 - dst->y0, (int32_t)dst->height - 1);
+
+	if (width == 0 || yt > yb) {
+		return;
+	}
+
+	for (size_t i = 0; i < count; i++) {
+		int32_t xl = MAX((int32_t)xs[i] - half1 - dst->x0, 0);
+		int32_t xr = MIN((int32_t)xs[i] + half0 - dst->x0,
+				 (int32_t)dst->width - 1);
+
+		if (xl > xr) {
+			continue;
+		}
+
+		if (dst->format == HUD_DRAW_A1) {
+			size_t pitch = (dst->stride + 7) / 8;
+			uint8_t *row = (uint8_t *)dst->buf + yt * pitch;
+
+			for (int32_t y = yt; y <= yb && color != 0; y++) {
+				hud_draw_bits(row, xl, xr);
+				row += pitch;
+			}
+		} else {
+			uint16_t *row = (uint16_t *)dst->buf + yt * dst->stride;
+
+			/* Spans are a few pixels, plain stores beat fill16 */
+			for (int32_t y = yt; y <= yb; y++) {
+				for (int32_t x = xl; x <= xr; x++) {
+					row[x] = color;
+				}
+				row += dst->stride;
+			}
+		}
+	}
+}
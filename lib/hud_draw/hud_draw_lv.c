@@ -0,0 +1,64 @@
+/*
+ * Copyright (c) 2024 kristosb
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <app/lib/hud_draw.h>
+#include <app/lib/hud_draw_lv.h>
+
+#include <zephyr/sys/util.h>
+
+BUILD_ASSERT(LV_COLOR_DEPTH == 16, "hud_draw_lv draws RGB565");
+
+bool hud_draw_lv_buf(lv_draw_ctx_t *draw_ctx, const lv_area_t *area,
+		     struct hud_draw_buf *dst)
+{
+	const lv_area_t *clip = draw_ctx->clip_area;
+	lv_coord_t stride = lv_area_get_width(draw_ctx->buf_area);
+
+	if (lv_draw_mask_is_any(area)) {
+		return false;
+	}
+
+	dst->buf = (lv_color_t *)draw_ctx->buf +
+		   (clip->y1 - draw_ctx->buf_area->y1) * stride +
+		   (clip->x1 - draw_ctx->buf_area->x1);
+	dst->stride = stride;
+	dst->x0 = clip->x1;
+	dst->y0 = clip->y1;
+	dst->width = lv_area_get_width(clip);
+	dst->height = lv_area_get_height(clip);
+	dst->format = HUD_DRAW_RGB565;
+
+	return true;
+}
+
+void hud_draw_lv_line(lv_draw_ctx_t *draw_ctx, const lv_draw_line_dsc_t *dsc,
+		      const lv_point_t *point1, const lv_point_t *point2)
+{
+	struct hud_draw_buf dst;
+	lv_area_t area;
+
+	/* Nothing to draw, as in lv_draw_line() */
+	if (dsc->width == 0 || dsc->opa <= LV_OPA_MIN ||
+	    (point1->x == point2->x && point1->y == point2->y)) {
+		return;
+	}
+
+	area.x1 = MIN(point1->x, point2->x) - dsc->width;
+	area.y1 = MIN(point1->y, point2->y) - dsc->width;
+	area.x2 = MAX(point1->x, point2->x) + dsc->width;
+	area.y2 = MAX(point1->y, point2->y) + dsc->width;
+
+	if (dsc->opa < LV_OPA_MAX || dsc->dash_width != 0 ||
+	    dsc->round_start || dsc->round_end ||
+	    dsc->blend_mode != LV_BLEND_MODE_NORMAL ||
+	    dsc->width > UINT8_MAX || !hud_draw_lv_buf(draw_ctx, &area, &dst)) {
+		lv_draw_line(draw_ctx, dsc, point1, point2);
+		return;
+	}
+
+	hud_draw_line(&dst, point1->x, point1->y, point2->x, point2->y,
+		      dsc->width, dsc->color.full);
+}
@@ -0,0 +1,340 @@
+/*
+ * Copyright (c) 2024 kristosb
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <app/lib/hud_draw.h>
+#include <app/lib/hud_scanline.h>
+
+#include <errno.h>
+#include <stdlib.h>
+#include <zephyr/drivers/display.h>
+#include <zephyr/init.h>
+#include <zephyr/kernel.h>
+#include <zephyr/sys/byteorder.h>
+#include <zephyr/sys/util.h>
+
+#define HUD_SL_GLYPH_W 5
+#define HUD_SL_GLYPH_H 7
+#define HUD_SL_GLYPH_ADVANCE (HUD_SL_GLYPH_W + 1)
+
+/* Sends the bands, so the next one is rendered meanwhile */
+K_THREAD_STACK_DEFINE(hud_sl_writer_stack, CONFIG_HUD_SCANLINE_WRITER_STACK_SIZE);
+static struct k_work_q hud_sl_writer;
+
+/*
+ * Own 5x7 font: the scene is rendered without LVGL, and lv_glyph_atlas
+ * holds glyphs rasterized from an lv_font_t.
+ */
+struct hud_sl_glyph {
+	char c;
+	/* One byte per row, bit 4 is the leftmost pixel */
+	uint8_t rows[HUD_SL_GLYPH_H];
+};
+
+static const struct hud_sl_glyph hud_sl_font[] = {
+	{ '0', { 0x0e, 0x11, 0x13, 0x15, 0x19, 0x11, 0x0e } },
+	{ '1', { 0x04, 0x0c, 0x04, 0x04, 0x04, 0x04, 0x0e } },
+	{ '2', { 0x0e, 0x11, 0x01, 0x02, 0x04, 0x08, 0x1f } },
+	{ '3', { 0x1f, 0x02, 0x04, 0x02, 0x01, 0x11, 0x0e } },
+	{ '4', { 0x02, 0x06, 0x0a, 0x12, 0x1f, 0x02, 0x02 } },
+	{ '5', { 0x1f, 0x10, 0x1e, 0x01, 0x01, 0x11, 0x0e } },
+	{ '6', { 0x06, 0x08, 0x10, 0x1e, 0x11, 0x11, 0x0e } },
+	{ '7', { 0x1f, 0x01, 0x02, 0x04, 0x08, 0x08, 0x08 } },
+	{ '8', { 0x0e, 0x11, 0x11, 0x0e, 0x11, 0x11, 0x0e } },
+	{ '9', { 0x0e, 0x11, 0x11, 0x0f, 0x01, 0x02, 0x0c } },
+	{ '-', { 0x00, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x00 } },
+	{ '.', { 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x0c } },
+	{ 'N', { 0x11, 0x19, 0x15, 0x13, 0x11, 0x11, 0x11 } },
+	{ 'E', { 0x1f, 0x10, 0x10, 0x1e, 0x10, 0x10, 0x1f } },
+	{ 'S', { 0x0f, 0x10, 0x10, 0x0e, 0x01, 0x01, 0x1e } },
+	{ 'W', { 0x11, 0x11, 0x11, 0x15, 0x15, 0x15, 0x0a } },
+};
+
+static const uint8_t *hud_sl_glyph(char c)
+{
+	for (size_t i = 0; i < ARRAY_SIZE(hud_sl_font); i++) {
+		if (hud_sl_font[i].c == c) {
+			return hud_sl_font[i].rows;
+		}
+	}
+
+	/* Unknown characters, and ' ', leave a gap */
+	return NULL;
+}
+
+/* Division rounding to nearest, d > 0 */
+static int hud_sl_div_round(int n, int d)
+{
+	return (n >= 0) ? (n + d / 2) / d : -((-n + d / 2) / d);
+}
+
+/* Division rounding up, d > 0 */
+static int hud_sl_div_ceil(int n, int d)
+{
+	return (n >= 0) ? (n + d - 1) / d : -((-n) / d);
+}
+
+/*
+ * Columns a one pixel line covers in row y: the pixel centers between
+ * where it enters the row (y - 0.5) and where it leaves it (y + 0.5), or
+ * the nearest column when a steep line passes between two centers. End
+ * points are clamped. The line runs from (ax, ay) down to (bx, by).
+ *
+ * Unlike hud_draw_line(), which steps from the start point, any row is
+ * evaluated on its own, so a band only pays for the rows it holds. End
+ * points are included.
+ */
+static bool hud_sl_line_span(int ax, int ay, int bx, int by, int y,
+			     int *xl, int *xr)
+{
+	int lo = MIN(ax, bx);
+	int hi = MAX(ax, bx);
+	int dx = bx - ax;
+	int dy = by - ay;
+	int n0;
+	int n1;
+	int a;
+	int b;
+
+	if (y < ay || y > by) {
+		return false;
+	}
+
+	if (dy == 0) {
+		*xl = lo;
+		*xr = hi;
+		return true;
+	}
+
+	n0 = dx * (2 * (y - ay) - 1);
+	n1 = dx * (2 * (y - ay) + 1);
+	a = ax + hud_sl_div_ceil(MIN(n0, n1), 2 * dy);
+	b = ax + hud_sl_div_ceil(MAX(n0, n1), 2 * dy) - 1;
+
+	if (b < a) {
+		a = ax + hud_sl_div_round(dx * (y - ay), dy);
+		b = a;
+	}
+
+	*xl = CLAMP(a, lo, hi);
+	*xr = CLAMP(b, lo, hi);
+
+	return true;
+}
+
+static void hud_sl_line(const struct hud_draw_buf *dst,
+			const struct hud_sl_prim *p)
+{
+	bool swap = p->y0 > p->y1;
+	int ax = swap ? p->x1 : p->x0;
+	int ay = swap ? p->y1 : p->y0;
+	int bx = swap ? p->x0 : p->x1;
+	int by = swap ? p->y0 : p->y1;
+	int w = MAX(p->width, 1);
+	int before = (w - 1) / 2;
+	int after = w - 1 - before;
+	bool steep = abs(bx - ax) <= by - ay;
+	int first = MAX((int)dst->y0, ay - (steep ? 0 : after));
+	int last = MIN((int)dst->y0 + dst->height - 1, by + (steep ? 0 : before));
+
+	for (int y = first; y <= last; y++) {
+		int xl;
+		int xr;
+
+		if (steep) {
+			/* Thickness across, widen the span */
+			if (!hud_sl_line_span(ax, ay, bx, by, y, &xl, &xr)) {
+				continue;
+			}
+			xl -= before;
+			xr += after;
+		} else {
+			/* Thickness along y, merge the rows covering this one */
+			int r0 = MAX(ay, y - after);
+			int r1 = MIN(by, y + before);
+			int l0, r0x, l1, r1x;
+
+			if (r0 > r1 ||
+			    !hud_sl_line_span(ax, ay, bx, by, r0, &l0, &r0x) ||
+			    !hud_sl_line_span(ax, ay, bx, by, r1, &l1, &r1x)) {
+				continue;
+			}
+			xl = MIN(l0, l1);
+			xr = MAX(r0x, r1x);
+		}
+
+		hud_draw_rect(dst, xl, y, xr, y, p->color);
+	}
+}
+
+static void hud_sl_text(const struct hud_draw_buf *dst,
+			const struct hud_sl_prim *p)
+{
+	int s = MAX(p->width, 1);
+	int x = p->x0;
+
+	if (p->y0 > dst->y0 + dst->height - 1 ||
+	    p->y0 + HUD_SL_GLYPH_H * s - 1 < dst->y0) {
+		return;
+	}
+
+	for (const char *c = p->text; *c != '\0'; c++) {
+		const uint8_t *glyph = hud_sl_glyph(*c);
+
+		for (int gy = 0; glyph != NULL && gy < HUD_SL_GLYPH_H; gy++) {
+			int y = p->y0 + gy * s;
+			int gx = 0;
+
+			/* One rectangle per run of set pixels in the glyph row */
+			while (gx < HUD_SL_GLYPH_W) {
+				int run = gx;
+
+				while (run < HUD_SL_GLYPH_W &&
+				       (glyph[gy] & BIT(HUD_SL_GLYPH_W - 1 - run))) {
+					run++;
+				}
+				if (run > gx) {
+					hud_draw_rect(dst, x + gx * s, y,
+						      x + run * s - 1, y + s - 1,
+						      p->color);
+				}
+				gx = run + 1;
+			}
+		}
+
+		x += HUD_SL_GLYPH_ADVANCE * s;
+	}
+}
+
+static void hud_sl_draw_band(const struct hud_sl_ctx *ctx, uint16_t *band,
+			     uint16_t y0, uint16_t rows,
+			     const struct hud_sl_prim *prims, size_t count)
+{
+	struct hud_draw_buf dst = {
+		.buf = band,
+		.stride = ctx->width,
+		.y0 = y0,
+		.width = ctx->width,
+		.height = rows,
+		.format = HUD_DRAW_RGB565,
+	};
+
+	hud_draw_fill16(band, (size_t)rows * ctx->width, ctx->bg);
+
+	for (size_t i = 0; i < count; i++) {
+		switch (prims[i].type) {
+		case HUD_SL_LINE:
+			hud_sl_line(&dst, &prims[i]);
+			break;
+		case HUD_SL_TEXT:
+			hud_sl_text(&dst, &prims[i]);
+			break;
+		default:
+			break;
+		}
+	}
+}
+
+static void hud_sl_write_work(struct k_work *work)
+{
+	struct hud_sl_ctx *ctx = CONTAINER_OF(work, struct hud_sl_ctx, write_work);
+
+	ctx->write_ret = display_write(ctx->display, 0, ctx->write_y,
+				       &ctx->write_desc, ctx->write_buf);
+	k_sem_give(&ctx->write_done);
+}
+
+uint16_t hud_sl_color(uint8_t r, uint8_t g, uint8_t b)
+{
+	uint16_t c = ((r >> 3) << 11) | ((g >> 2) << 5) | (b >> 3);
+
+	if (IS_ENABLED(CONFIG_HUD_SCANLINE_NATIVE_ORDER)) {
+		return c;
+	}
+
+	return sys_cpu_to_be16(c);
+}
+
+int hud_sl_init(struct hud_sl_ctx *ctx, const struct device *display,
+		uint16_t *band, size_t band_px)
+{
+	struct display_capabilities caps;
+
+	display_get_capabilities(display, &caps);
+
+	if (band_px < 2 * caps.x_resolution) {
+		return -EINVAL;
+	}
+
+	ctx->display = display;
+	ctx->width = caps.x_resolution;
+	ctx->height = caps.y_resolution;
+	ctx->rows = MIN(CONFIG_HUD_SCANLINE_BAND_ROWS,
+			band_px / 2 / caps.x_resolution);
+	ctx->band[0] = band;
+	ctx->band[1] = band + ctx->rows * ctx->width;
+	ctx->bg = 0;
+
+	ctx->write_desc.width = ctx->width;
+	ctx->write_desc.pitch = ctx->width;
+	k_work_init(&ctx->write_work, hud_sl_write_work);
+	k_sem_init(&ctx->write_done, 0, 1);
+
+	return 0;
+}
+
+void hud_sl_render_band(const struct hud_sl_ctx *ctx, uint16_t y0,
+			uint16_t rows, const struct hud_sl_prim *prims,
+			size_t count)
+{
+	hud_sl_draw_band(ctx, ctx->band[0], y0, rows, prims, count);
+}
+
+int hud_sl_render(struct hud_sl_ctx *ctx, const struct hud_sl_prim *prims,
+		  size_t count)
+{
+	int b = 0;
+
+	for (uint16_t y = 0; y < ctx->height; y += ctx->rows) {
+		uint16_t rows = MIN(ctx->rows, ctx->height - y);
+
+		/* While the previous band is on the bus */
+		hud_sl_draw_band(ctx, ctx->band[b], y, rows, prims, count);
+
+		if (y > 0) {
+			k_sem_take(&ctx->write_done, K_FOREVER);
+			if (ctx->write_ret < 0) {
+				return ctx->write_ret;
+			}
+		}
+
+		ctx->write_desc.height = rows;
+		ctx->write_desc.buf_size = rows * ctx->width * sizeof(uint16_t);
+		ctx->write_buf = ctx->band[b];
+		ctx->write_y = y;
+		k_work_submit_to_queue(&hud_sl_writer, &ctx->write_work);
+
+		b ^= 1;
+	}
+
+	k_sem_take(&ctx->write_done, K_FOREVER);
+
+	return ctx->write_ret;
+}
+
+static int hud_sl_writer_init(void)
+{
+	const struct k_work_queue_config cfg = {
+		.name = "hud_sl_writer",
+	};
+
+	k_work_queue_start(&hud_sl_writer, hud_sl_writer_stack,
+			   K_THREAD_STACK_SIZEOF(hud_sl_writer_stack),
+			   CONFIG_HUD_SCANLINE_WRITER_PRIORITY, &cfg);
+
+	return 0;
+}
+
+SYS_INIT(hud_sl_writer_init, APPLICATION, CONFIG_APPLICATION_INIT_PRIORITY);
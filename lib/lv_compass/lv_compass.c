@@ -28,6 +28,15 @@ SOFTWARE.
  *********************/
 #include <math.h>
 #include <app/lib/lv_compass.h>
+#ifdef CONFIG_LV_GLYPH_ATLAS
+#include <app/lib/lv_glyph_atlas.h>
+#endif
+#if defined(CONFIG_LV_COMPASS_FAST_LINES) || defined(CONFIG_LV_COMPASS_BATCH_TICKS)
+#include <app/lib/hud_draw_lv.h>
+#endif
+#ifdef CONFIG_LV_COMPASS_TAPE_CACHE
+#include <app/lib/hud_draw.h>
+#endif
 
 #include <core/lv_group.h>
 #include <misc/lv_assert.h>
@@ -54,6 +63,18 @@ LOG_MODULE_REGISTER(lv_compass, CONFIG_SENSOR_LOG_LEVEL);
 #define LV_COMPASS_DEFAULT_LABEL_GAP      ((uint32_t) 15U)
 
 #define LV_COMPASS_NONE 256
+
+/* Tape band, labels and ticks, scrolls with the heading */
+#define LV_COMPASS_TAPE_ROWS    (COMPAS_FONT_HEIGHT + COMPAS_MAJOR_TICK_LENGHT)
+
+/* Heading readout box, below the tape right of the center mark */
+#define LV_COMPASS_READOUT_X    (COMPAS_WIDTH / 2 + 2)
+#define LV_COMPASS_READOUT_Y    (COMPAS_FONT_HEIGHT + COMPAS_MAJOR_TICK_LENGHT)
+#define LV_COMPASS_READOUT_W    (31)
+
+/* Tape cache, 360 degrees of the tape band, 1 bit alpha per pixel */
+#define LV_COMPASS_TAPE_WIDTH   (360 / LV_COMPASS_SCALE * LV_COMPASS_SPACE)
+#define LV_COMPASS_TAPE_STRIDE  ((LV_COMPASS_TAPE_WIDTH + 7) / 8)
 /**********************
  *      TYPEDEFS
  **********************/
@@ -85,10 +106,25 @@ const lv_obj_class_t lv_compass_class  = {
     //.name = "compass",
 };
 
+#ifdef CONFIG_LV_COMPASS_TAPE_CACHE
+/*Shared by all compasses, heading 0 at column 0*/
+static uint8_t tape_buf[LV_COMPASS_TAPE_STRIDE * LV_COMPASS_TAPE_ROWS];
+static lv_coord_t tape_line_width = -1;
+static const lv_font_t * tape_font;
+#endif
+
 /**********************
  *      MACROS
  **********************/
 
+/*Tape position in pixels for a heading, the same for h and h + 360*/
+static inline int32_t lv_compass_scroll(int32_t heading)
+{
+    heading = ((heading % 360) + 360) % 360;
+    return heading / LV_COMPASS_SCALE * LV_COMPASS_SPACE +
+           (heading % LV_COMPASS_SCALE) * LV_COMPASS_SPACE / LV_COMPASS_SCALE;
+}
+
 /**********************
  *   GLOBAL FUNCTIONS
  **********************/
@@ -116,10 +152,36 @@ void lv_compass_angle(lv_obj_t * obj, int32_t angle)
     LV_ASSERT_OBJ(obj, MY_CLASS);
     lv_compass_t * compass = (lv_compass_t *)obj;
 
+    /*Shortest way around, the tape wraps at 360*/
+    int32_t diff = (angle - compass->heading_angle) % 360;
+    if(diff > 180) diff -= 360;
+    if(diff < -180) diff += 360;
+
+    /*The tape is drawn in DRAW_MAIN and invalidation already waits for the
+     *next refresh, so only drop updates that would not show*/
+    if(compass->widget_draw && (angle == compass->heading_angle ||
+       (diff != 0 && LV_ABS(diff) <= CONFIG_LV_COMPASS_DEADBAND))) return;
+
+    int32_t old_scroll = lv_compass_scroll(compass->heading_angle);
+    lv_area_t area;
+
     compass->heading_angle = angle;
     compass->widget_draw = true;
 
-    lv_obj_invalidate(obj);
+    /*The center mark never changes, the tape only when it moves by a pixel*/
+    if(lv_compass_scroll(angle) != old_scroll) {
+        area.x1 = obj->coords.x1;
+        area.y1 = obj->coords.y1;
+        area.x2 = obj->coords.x1 + COMPAS_WIDTH - 1;
+        area.y2 = obj->coords.y1 + LV_COMPASS_TAPE_ROWS - 1;
+        lv_obj_invalidate_area(obj, &area);
+    }
+
+    area.x1 = obj->coords.x1 + LV_COMPASS_READOUT_X;
+    area.y1 = obj->coords.y1 + LV_COMPASS_READOUT_Y;
+    area.x2 = area.x1 + LV_COMPASS_READOUT_W - 1;
+    area.y2 = obj->coords.y2;
+    lv_obj_invalidate_area(obj, &area);
 }
 void lv_compass_set_dark_style(lv_obj_t * obj)
 {
@@ -142,6 +204,15 @@ void lv_compass_set_light_style(lv_obj_t * obj)
     lv_draw_line_dsc_t *line_dsc = &(compass->line_dsc);
     line_dsc->color = lv_color_black();
 }
+void lv_compass_set_color(lv_obj_t * obj, lv_color_t color)
+{
+    LV_ASSERT_OBJ(obj, MY_CLASS);
+    lv_compass_t * compass = (lv_compass_t *)obj;
+
+    compass->label_dsc.color = color;
+    compass->line_dsc.color = color;
+    lv_obj_invalidate(obj);
+}
 void lv_compass_set_line_width(lv_obj_t * obj, lv_coord_t width)
 {
     LV_ASSERT_OBJ(obj, MY_CLASS);
@@ -173,6 +244,9 @@ static void lv_compass_constructor(const lv_obj_class_t * class_p, lv_obj_t * ob
 
     lv_draw_label_dsc_init(&(compass->label_dsc));
     lv_draw_line_dsc_init(&(compass->line_dsc));
+#ifdef CONFIG_LV_GLYPH_ATLAS
+    lv_glyph_atlas_init(compass->label_dsc.font);
+#endif
 
     //lv_canvas_fill_bg(compass, lv_color_make(0x00, 0x00, 0x00), LV_OPA_COVER);
     //lv_obj_set_style_bg_color((lv_obj_t *)compass, lv_color_hex(0xFF0000), LV_PART_MAIN);
@@ -201,8 +275,6 @@ static void lv_compass_destructor(const lv_obj_class_t * class_p, lv_obj_t * obj
 static void lv_compass_draw_label( lv_draw_ctx_t * layer, lv_draw_label_dsc_t *dsc, int16_t x, int16_t y, int16_t angle, int tick_num)
 {
     char buf[8] = {0};
-    lv_snprintf(buf, sizeof(buf), "%d", (int16_t)tick_num);
-        
     lv_area_t label_coords;
 
     label_coords.x1 = COMPAS_WIDTH / 2 + x;
@@ -210,8 +282,24 @@ static void lv_compass_draw_label( lv_draw_ctx_t * layer, lv_draw_label_dsc_t *d
     label_coords.x2 = 30 + COMPAS_WIDTH / 2 + x;
     label_coords.y2 = 14 + y;
 
+#ifdef CONFIG_LV_GLYPH_ATLAS
+    lv_point_t pos = {label_coords.x1, label_coords.y1};
+    if(lv_glyph_atlas_draw_int(layer, dsc, &pos, (int16_t)tick_num, false) == LV_RES_OK) return;
+#endif
+
+    lv_snprintf(buf, sizeof(buf), "%d", (int16_t)tick_num);
     lv_draw_label((struct _lv_draw_ctx_t *)layer, dsc, &label_coords, buf, NULL);
 
+}
+/*Ticks are solid vertical lines, no need for the anti-aliased path*/
+static inline void lv_compass_draw_line(lv_draw_ctx_t *layer, const lv_draw_line_dsc_t *dsc,
+                                        const lv_point_t *a, const lv_point_t *b)
+{
+#ifdef CONFIG_LV_COMPASS_FAST_LINES
+    hud_draw_lv_line(layer, dsc, a, b);
+#else
+    lv_draw_line(layer, dsc, a, b);
+#endif
 }
 static void lv_compass_draw_tick_major( lv_draw_ctx_t *layer, lv_draw_line_dsc_t *dsc, int16_t x, int16_t y, int16_t angle)
 {
@@ -221,7 +309,7 @@ static void lv_compass_draw_tick_major( lv_draw_ctx_t *layer, lv_draw_line_dsc_t
     tick_point_a.y = COMPAS_FONT_HEIGHT + y;
     tick_point_b.x = COMPAS_WIDTH / 2 + x;
     tick_point_b.y = COMPAS_FONT_HEIGHT + COMPAS_MAJOR_TICK_LENGHT + y;
-    lv_draw_line((struct _lv_draw_ctx_t *)layer, dsc, &tick_point_a, &tick_point_b);
+    lv_compass_draw_line(layer, dsc, &tick_point_a, &tick_point_b);
 }
 static void lv_compass_draw_tick_minor( lv_draw_ctx_t *layer, lv_draw_line_dsc_t *dsc, int16_t x, int16_t y, int16_t angle)
 {
@@ -231,8 +319,43 @@ static void lv_compass_draw_tick_minor( lv_draw_ctx_t *layer, lv_draw_line_dsc_t
     tick_point_a.y = COMPAS_FONT_HEIGHT;
     tick_point_b.x = COMPAS_WIDTH / 2 + COMPAS_TICK_SPACING /2 + x;
     tick_point_b.y = COMPAS_FONT_HEIGHT + COMPAS_MINOR_TICK_LENGHT;
-    lv_draw_line((struct _lv_draw_ctx_t *)layer, dsc, &tick_point_a, &tick_point_b);
+    lv_compass_draw_line(layer, dsc, &tick_point_a, &tick_point_b);
+}
+#ifdef CONFIG_LV_COMPASS_BATCH_TICKS
+/**
+ * Draw all major and minor ticks in view and the center mark in one pass
+ * over the clip area: the same pixels as lv_compass_draw_tick_major() and
+ * lv_compass_draw_tick_minor(), as vertical spans sharing one clip check.
+ * @return false if LVGL has to draw the ticks, e.g. for translucent lines
+ */
+static bool lv_compass_draw_ticks( lv_draw_ctx_t *layer, const lv_draw_line_dsc_t *dsc,
+                                   const lv_compass_tick_info_t *ticks)
+{
+    int16_t major[LV_COMPASS_TICK_RANGE + 1];
+    int16_t minor[LV_COMPASS_TICK_RANGE + 1];
+    int16_t center = COMPAS_WIDTH / 2;
+    struct hud_draw_buf dst;
+    lv_area_t area = {0, 0, COMPAS_WIDTH - 1, COMPAS_HEIGHT - 1};
+
+    if(dsc->opa < LV_OPA_MAX || dsc->dash_width != 0 || dsc->round_start || dsc->round_end ||
+       dsc->width > UINT8_MAX || dsc->blend_mode != LV_BLEND_MODE_NORMAL) return false;
+    if(!hud_draw_lv_buf(layer, &area, &dst)) return false;
+
+    for(int i = 0; i < LV_COMPASS_TICK_RANGE + 1; i++) {
+        major[i] = COMPAS_WIDTH / 2 + ticks[i].x_offset;
+        minor[i] = COMPAS_WIDTH / 2 + COMPAS_TICK_SPACING / 2 + ticks[i].x_offset;
+    }
+
+    hud_draw_vlines(&dst, major, LV_COMPASS_TICK_RANGE + 1, COMPAS_FONT_HEIGHT,
+                    COMPAS_FONT_HEIGHT + COMPAS_MAJOR_TICK_LENGHT - 1, dsc->width, dsc->color.full);
+    hud_draw_vlines(&dst, minor, LV_COMPASS_TICK_RANGE + 1, COMPAS_FONT_HEIGHT,
+                    COMPAS_FONT_HEIGHT + COMPAS_MINOR_TICK_LENGHT - 1, dsc->width, dsc->color.full);
+    hud_draw_vlines(&dst, &center, 1, COMPAS_FONT_HEIGHT + 1 + COMPAS_MAJOR_TICK_LENGHT,
+                    COMPAS_FONT_HEIGHT + 1 + 2 * COMPAS_MAJOR_TICK_LENGHT - 1, dsc->width, dsc->color.full);
+
+    return true;
 }
+#endif
 static int32_t lv_compass_limit(int32_t value)
 {
     int32_t result = value;
@@ -244,18 +367,137 @@ static int32_t lv_compass_limit(int32_t value)
     if(value > 359) result = result - 360;
     return result;
 }
+#ifdef CONFIG_LV_COMPASS_TAPE_CACHE
+/**
+ * Render labels and ticks from 0 to 350 into the tape. Everything is also
+ * drawn one tape length to the left and right, so what crosses 0/360
+ * shows up at the other end.
+ * @return false if the labels can not be drawn from the glyph atlas
+ */
+static bool lv_compass_render_tape( lv_compass_t * compass)
+{
+    struct hud_draw_buf dst = {
+        .buf = tape_buf,
+        .stride = LV_COMPASS_TAPE_WIDTH,
+        .width = LV_COMPASS_TAPE_WIDTH,
+        .height = LV_COMPASS_TAPE_ROWS,
+        .format = HUD_DRAW_A1,
+    };
+    uint8_t width = compass->line_dsc.width;
+
+    lv_memset_00(tape_buf, sizeof(tape_buf));
+    tape_font = NULL;
+
+    for(int32_t value = 0; value < 360; value += LV_COMPASS_SCALE) {
+        for(int32_t wrap = -1; wrap <= 1; wrap++) {
+            lv_coord_t x = value / LV_COMPASS_SCALE * LV_COMPASS_SPACE + wrap * LV_COMPASS_TAPE_WIDTH;
+            lv_point_t pos = {x, 0};
+
+            if(lv_glyph_atlas_draw_int_a1(tape_buf, LV_COMPASS_TAPE_WIDTH, LV_COMPASS_TAPE_ROWS,
+                                          &(compass->label_dsc), &pos, value, false) != LV_RES_OK) {
+                return false;
+            }
+            hud_draw_line(&dst, x, COMPAS_FONT_HEIGHT, x, COMPAS_FONT_HEIGHT + COMPAS_MAJOR_TICK_LENGHT,
+                          width, 1);
+            hud_draw_line(&dst, x + COMPAS_TICK_SPACING / 2, COMPAS_FONT_HEIGHT,
+                          x + COMPAS_TICK_SPACING / 2, COMPAS_FONT_HEIGHT + COMPAS_MINOR_TICK_LENGHT,
+                          width, 1);
+        }
+    }
+
+    tape_line_width = compass->line_dsc.width;
+    tape_font = compass->label_dsc.font;
+    return true;
+}
+
+static void lv_compass_blit_row(lv_color_t * dst, const uint8_t * src, int32_t col, int32_t len,
+                                lv_color_t color)
+{
+    for(int32_t i = 0; i < len;) {
+        int32_t c = col + i;
+        uint8_t bits = src[c >> 3];
+
+        /*Most of the tape is empty, skip whole bytes*/
+        if(bits == 0 && (c & 7) == 0 && len - i >= 8) {
+            i += 8;
+            continue;
+        }
+        if(bits & (0x80 >> (c & 7))) dst[i] = color;
+        i++;
+    }
+}
+
+/**
+ * Copy the tape window for the current heading straight into the draw
+ * buffer, one run per row, or two where the window crosses 0/360. Labels
+ * take the label color, the tick rows below them the line color.
+ * @return false if the tape can not be used and the caller draws it live
+ */
+static bool lv_compass_blit_tape( lv_obj_t * obj, lv_draw_ctx_t * draw_ctx)
+{
+    lv_compass_t * compass = (lv_compass_t *)obj;
+    lv_coord_t stride = lv_area_get_width(draw_ctx->buf_area);
+    lv_area_t tape;
+    lv_area_t clip;
+
+    if(compass->label_dsc.opa < LV_OPA_MAX || compass->line_dsc.opa < LV_OPA_MAX) return false;
+
+    if(tape_font != compass->label_dsc.font || tape_line_width != compass->line_dsc.width) {
+        if(!lv_compass_render_tape(compass)) return false;
+    }
+
+    tape.x1 = obj->coords.x1;
+    tape.y1 = obj->coords.y1;
+    tape.x2 = tape.x1 + COMPAS_WIDTH - 1;
+    tape.y2 = tape.y1 + LV_COMPASS_TAPE_ROWS - 1;
+    if(lv_draw_mask_is_any(&tape)) return false;
+    if(!_lv_area_intersect(&clip, &tape, draw_ctx->clip_area)) return true;
+
+    int32_t scroll = lv_compass_scroll(compass->heading_angle) - COMPAS_WIDTH / 2;
+    int32_t col0 = (clip.x1 - tape.x1 + scroll + LV_COMPASS_TAPE_WIDTH) % LV_COMPASS_TAPE_WIDTH;
+
+    for(lv_coord_t y = clip.y1; y <= clip.y2; y++) {
+        lv_coord_t row = y - tape.y1;
+        lv_color_t color = row < COMPAS_FONT_HEIGHT ? compass->label_dsc.color : compass->line_dsc.color;
+        lv_color_t * dst = (lv_color_t *)draw_ctx->buf + (y - draw_ctx->buf_area->y1) * stride +
+                           (clip.x1 - draw_ctx->buf_area->x1);
+        int32_t col = col0;
+        int32_t len = lv_area_get_width(&clip);
+
+        while(len > 0) {
+            int32_t run = LV_MIN(len, LV_COMPASS_TAPE_WIDTH - col);
+
+            lv_compass_blit_row(dst, &tape_buf[row * LV_COMPASS_TAPE_STRIDE], col, run, color);
+            dst += run;
+            len -= run;
+            col = 0;
+        }
+    }
+
+    return true;
+}
+#endif
+
 static void lv_compass_redraw( lv_obj_t * obj, lv_event_t * event)
 {
     lv_compass_t * compass = (lv_compass_t *)obj;
     lv_draw_ctx_t *layer = lv_event_get_draw_ctx(event);
 
-    
+#ifdef CONFIG_LV_COMPASS_TAPE_CACHE
+    if(lv_compass_blit_tape(obj, layer)) {
+        lv_compass_draw_tick_major((struct _lv_draw_ctx_t *)layer, &(compass->line_dsc), 0, 1 + COMPAS_MAJOR_TICK_LENGHT, 0);
+        lv_compass_draw_label((struct _lv_draw_ctx_t *)layer, &(compass->label_dsc), 2, COMPAS_MAJOR_TICK_LENGHT + COMPAS_FONT_HEIGHT, 0, compass->heading_angle);
+        return;
+    }
+#endif
 
-    int32_t x_offset = -(compass->heading_angle%10)*LV_COMPASS_SPACE/10;
+    /*Same tape for h and h + 360, lv_compass_angle() relies on it*/
+    int32_t heading = ((compass->heading_angle % 360) + 360) % 360;
+    int32_t x_offset = -(heading%10)*LV_COMPASS_SPACE/10;
 
     int16_t scale = LV_COMPASS_SCALE;// tick lenght
     int16_t tickRange = LV_COMPASS_TICK_RANGE;  // number of ticks
-    int16_t scaleStart = (floor(compass->heading_angle/scale)*scale-floor(scale*tickRange/2));
+    int16_t scaleStart = (floor(heading/scale)*scale-floor(scale*tickRange/2));
 
     //LOG_INF("start = %d, offset = %d, heading = %d", scaleStart, xoffset, heading);
     lv_compass_tick_info_t scaleValues[LV_COMPASS_TICK_RANGE + 1] = {
@@ -272,12 +514,20 @@ static void lv_compass_redraw( lv_obj_t * obj, lv_event_t * event)
     // lv_draw_line_dsc_t main_line_dsc;
     // lv_draw_line_dsc_init(&main_line_dsc);
 
+    bool ticks_drawn = false;
+#ifdef CONFIG_LV_COMPASS_BATCH_TICKS
+    ticks_drawn = lv_compass_draw_ticks(layer, &(compass->line_dsc), scaleValues);
+#endif
+
     for(int i = 0; i < LV_COMPASS_TICK_RANGE + 1; i++){
         lv_compass_draw_label((struct _lv_draw_ctx_t *)layer, &(compass->label_dsc), scaleValues[i].x_offset, 0, 0, scaleValues[i].label_value);
+        if(ticks_drawn) continue;
         lv_compass_draw_tick_major((struct _lv_draw_ctx_t *)layer, &(compass->line_dsc), scaleValues[i].x_offset, 0, 0);
         lv_compass_draw_tick_minor((struct _lv_draw_ctx_t *)layer, &(compass->line_dsc), scaleValues[i].x_offset, 0, 0);
     }
-    lv_compass_draw_tick_major((struct _lv_draw_ctx_t *)layer, &(compass->line_dsc), 0, 1 + COMPAS_MAJOR_TICK_LENGHT, 0);
+    if(!ticks_drawn) {
+        lv_compass_draw_tick_major((struct _lv_draw_ctx_t *)layer, &(compass->line_dsc), 0, 1 + COMPAS_MAJOR_TICK_LENGHT, 0);
+    }
     lv_compass_draw_label((struct _lv_draw_ctx_t *)layer, &(compass->label_dsc), 2, COMPAS_MAJOR_TICK_LENGHT + COMPAS_FONT_HEIGHT, 0, compass->heading_angle);
 
     //lv_obj_set_style_bg_color(obj, lv_color_hex(0x00FF00), LV_PART_MAIN);
@@ -0,0 +1,273 @@
+/*
+MIT License
+
+Copyright (c) 2024 kristosb
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+ */ 
+
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include <app/lib/lv_glyph_atlas.h>
+
+#include <misc/lv_area.h>
+#include <misc/lv_math.h>
+#include <draw/sw/lv_draw_sw.h>
+#include <zephyr/logging/log.h>
+
+#include <lvgl.h>
+
+LOG_MODULE_REGISTER(lv_glyph_atlas, CONFIG_SENSOR_LOG_LEVEL);
+
+/*********************
+ *      DEFINES
+ *********************/
+#define LV_GLYPH_ATLAS_COUNT        (sizeof(LV_GLYPH_ATLAS_CHARS) - 1)
+#define LV_GLYPH_ATLAS_SPACE_IDX    (0U)
+#define LV_GLYPH_ATLAS_MINUS_IDX    (1U)
+#define LV_GLYPH_ATLAS_DIGIT_IDX    (2U)
+
+/*Largest glyph box, the blend mask is on the stack*/
+#define LV_GLYPH_ATLAS_MASK_MAX     (256U)
+
+/*Sign, 10 digits*/
+#define LV_GLYPH_ATLAS_INT_LEN      (11U)
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+typedef struct {
+    uint16_t x;         /**< First atlas column of the glyph box*/
+    uint8_t box_w;
+    uint8_t box_h;
+    int8_t ofs_x;       /**< Box left edge from the pen position*/
+    int8_t top;         /**< Box top edge from the top of the line*/
+    uint8_t adv_w;
+} lv_glyph_atlas_glyph_t;
+
+/**********************
+ *  STATIC VARIABLES
+ **********************/
+
+/*Glyph boxes side by side, 4 bits per pixel, high nibble first*/
+static uint8_t atlas_buf[CONFIG_LV_GLYPH_ATLAS_SIZE];
+static uint16_t atlas_stride;
+static lv_glyph_atlas_glyph_t atlas_glyphs[LV_GLYPH_ATLAS_COUNT];
+static const lv_font_t * atlas_font;
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+
+static uint8_t lv_glyph_atlas_get_px(lv_coord_t x, lv_coord_t y)
+{
+    uint8_t b = atlas_buf[y * atlas_stride + x / 2];
+
+    return (x & 1) ? (b & 0x0F) : (b >> 4);
+}
+
+static void lv_glyph_atlas_set_px(lv_coord_t x, lv_coord_t y, uint8_t v)
+{
+    uint8_t * b = &atlas_buf[y * atlas_stride + x / 2];
+
+    if(x & 1) *b = (*b & 0xF0) | v;
+    else *b = (*b & 0x0F) | (v << 4);
+}
+
+/**
+ * Atlas entries of the characters of `value`, what "%d" or " %d" would
+ * print.
+ * @return number of entries
+ */
+static uint32_t lv_glyph_atlas_format(int32_t value, bool pad, uint8_t idx[LV_GLYPH_ATLAS_INT_LEN])
+{
+    uint8_t digits[LV_GLYPH_ATLAS_INT_LEN - 1];
+    uint32_t u = value < 0 ? -(uint32_t)value : (uint32_t)value;
+    uint32_t n = 0;
+    uint32_t cnt = 0;
+
+    do {
+        digits[n++] = u % 10;
+        u /= 10;
+    } while(u);
+
+    if(value < 0) idx[cnt++] = LV_GLYPH_ATLAS_MINUS_IDX;
+    else if(pad) idx[cnt++] = LV_GLYPH_ATLAS_SPACE_IDX;
+
+    while(n) idx[cnt++] = LV_GLYPH_ATLAS_DIGIT_IDX + digits[--n];
+
+    return cnt;
+}
+
+/**********************
+ *   GLOBAL FUNCTIONS
+ **********************/
+
+lv_res_t lv_glyph_atlas_init(const lv_font_t * font)
+{
+    lv_font_glyph_dsc_t g;
+    uint32_t width = 0;
+    uint32_t height = 0;
+    uint16_t x = 0;
+
+    if(font == NULL) return LV_RES_INV;
+    if(font == atlas_font) return LV_RES_OK;
+
+    atlas_font = NULL;
+
+    for(uint32_t i = 0; i < LV_GLYPH_ATLAS_COUNT; i++) {
+        if(!lv_font_get_glyph_dsc(font, &g, LV_GLYPH_ATLAS_CHARS[i], 0)) return LV_RES_INV;
+        /*Packed bitmaps only, no 3 bpp and no compression*/
+        if(g.bpp != 1 && g.bpp != 2 && g.bpp != 4 && g.bpp != 8) return LV_RES_INV;
+        if(g.box_w * g.box_h > LV_GLYPH_ATLAS_MASK_MAX) return LV_RES_INV;
+        width += g.box_w;
+        height = LV_MAX(height, g.box_h);
+    }
+
+    atlas_stride = (width + 1) / 2;
+    if(atlas_stride * height > sizeof(atlas_buf)) {
+        LOG_WRN("%u bytes needed", atlas_stride * height);
+        return LV_RES_INV;
+    }
+    lv_memset_00(atlas_buf, sizeof(atlas_buf));
+
+    for(uint32_t i = 0; i < LV_GLYPH_ATLAS_COUNT; i++) {
+        lv_glyph_atlas_glyph_t * glyph = &atlas_glyphs[i];
+        const uint8_t * bitmap;
+        uint32_t max;
+
+        lv_font_get_glyph_dsc(font, &g, LV_GLYPH_ATLAS_CHARS[i], 0);
+        glyph->x = x;
+        glyph->box_w = g.box_w;
+        glyph->box_h = g.box_h;
+        glyph->ofs_x = g.ofs_x;
+        /*Same placement as lv_draw_letter()*/
+        glyph->top = (font->line_height - font->base_line) - g.box_h - g.ofs_y;
+        glyph->adv_w = g.adv_w;
+        x += g.box_w;
+
+        if(g.box_w == 0 || g.box_h == 0) continue;
+
+        bitmap = lv_font_get_glyph_bitmap(font, LV_GLYPH_ATLAS_CHARS[i]);
+        if(bitmap == NULL) return LV_RES_INV;
+
+        /*Rows are not byte aligned in the font, convert to 4 bits*/
+        max = (1U << g.bpp) - 1;
+        for(uint32_t row = 0; row < g.box_h; row++) {
+            for(uint32_t col = 0; col < g.box_w; col++) {
+                uint32_t bit = (row * g.box_w + col) * g.bpp;
+                uint32_t v = (bitmap[bit >> 3] >> (8 - g.bpp - (bit & 7))) & max;
+
+                lv_glyph_atlas_set_px(glyph->x + col, row, v * 15 / max);
+            }
+        }
+    }
+
+    atlas_font = font;
+    return LV_RES_OK;
+}
+
+lv_res_t lv_glyph_atlas_draw_int(lv_draw_ctx_t * draw_ctx, const lv_draw_label_dsc_t * dsc,
+                                 const lv_point_t * pos, int32_t value, bool pad)
+{
+    uint8_t idx[LV_GLYPH_ATLAS_INT_LEN];
+    lv_opa_t mask[LV_GLYPH_ATLAS_MASK_MAX];
+    lv_draw_sw_blend_dsc_t blend_dsc;
+    lv_coord_t pen = pos->x;
+    uint32_t cnt;
+
+    if(atlas_font == NULL || dsc->font != atlas_font) return LV_RES_INV;
+    if(dsc->opa <= LV_OPA_MIN) return LV_RES_OK;
+
+    lv_memset_00(&blend_dsc, sizeof(blend_dsc));
+    blend_dsc.color = dsc->color;
+    blend_dsc.opa = dsc->opa;
+    blend_dsc.blend_mode = dsc->blend_mode;
+    blend_dsc.mask_buf = mask;
+    blend_dsc.mask_res = LV_DRAW_MASK_RES_CHANGED;
+
+    cnt = lv_glyph_atlas_format(value, pad, idx);
+    for(uint32_t i = 0; i < cnt; i++) {
+        const lv_glyph_atlas_glyph_t * glyph = &atlas_glyphs[idx[i]];
+        lv_area_t area;
+        lv_area_t clipped;
+        uint32_t k = 0;
+
+        area.x1 = pen + glyph->ofs_x;
+        area.y1 = pos->y + glyph->top;
+        area.x2 = area.x1 + glyph->box_w - 1;
+        area.y2 = area.y1 + glyph->box_h - 1;
+        pen += glyph->adv_w + dsc->letter_space;
+
+        if(glyph->box_w == 0 || glyph->box_h == 0) continue;
+        if(!_lv_area_intersect(&clipped, &area, draw_ctx->clip_area)) continue;
+
+        /*4 bit coverage to opacity, as _lv_bpp4_opa_table does*/
+        for(lv_coord_t y = clipped.y1; y <= clipped.y2; y++) {
+            for(lv_coord_t x = clipped.x1; x <= clipped.x2; x++) {
+                mask[k++] = lv_glyph_atlas_get_px(glyph->x + x - area.x1, y - area.y1) * 17;
+            }
+        }
+
+        blend_dsc.blend_area = &clipped;
+        blend_dsc.mask_area = &clipped;
+        lv_draw_sw_blend(draw_ctx, &blend_dsc);
+    }
+
+    return LV_RES_OK;
+}
+
+lv_res_t lv_glyph_atlas_draw_int_a1(uint8_t * buf, lv_coord_t w, lv_coord_t h,
+                                    const lv_draw_label_dsc_t * dsc,
+                                    const lv_point_t * pos, int32_t value, bool pad)
+{
+    uint8_t idx[LV_GLYPH_ATLAS_INT_LEN];
+    const lv_coord_t stride = (w + 7) / 8;
+    lv_coord_t pen = pos->x;
+    uint32_t cnt;
+
+    if(atlas_font == NULL || dsc->font != atlas_font) return LV_RES_INV;
+
+    cnt = lv_glyph_atlas_format(value, pad, idx);
+    for(uint32_t i = 0; i < cnt; i++) {
+        const lv_glyph_atlas_glyph_t * glyph = &atlas_glyphs[idx[i]];
+        lv_coord_t x0 = pen + glyph->ofs_x;
+        lv_coord_t y0 = pos->y + glyph->top;
+
+        pen += glyph->adv_w + dsc->letter_space;
+
+        for(lv_coord_t row = 0; row < glyph->box_h; row++) {
+            lv_coord_t y = y0 + row;
+
+            if(y < 0 || y >= h) continue;
+            for(lv_coord_t col = 0; col < glyph->box_w; col++) {
+                lv_coord_t x = x0 + col;
+
+                if(x < 0 || x >= w) continue;
+                if(lv_glyph_atlas_get_px(glyph->x + col, row) >= 8) {
+                    buf[y * stride + x / 8] |= 0x80 >> (x & 7);
+                }
+            }
+        }
+    }
+
+    return LV_RES_OK;
+}
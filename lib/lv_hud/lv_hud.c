@@ -0,0 +1,173 @@
+/*
+MIT License
+
+Copyright (c) 2024 kristosb
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+ */ 
+
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include <app/lib/lv_hud.h>
+#include <app/lib/lv_compass.h>
+#include <app/lib/lv_pitch_ladder.h>
+
+#include <core/lv_event.h>
+#include <misc/lv_assert.h>
+#include <misc/lv_area.h>
+#include <zephyr/logging/log.h>
+
+#include <lvgl.h>
+
+LOG_MODULE_REGISTER(lv_hud, CONFIG_SENSOR_LOG_LEVEL);
+
+/*********************
+ *      DEFINES
+ *********************/
+#define MY_CLASS (&lv_hud_class)
+
+/**********************
+ *  STATIC PROTOTYPES
+ **********************/
+static void lv_hud_constructor(const lv_obj_class_t * class_p, lv_obj_t * obj);
+static void lv_hud_event(const lv_obj_class_t * class_p, lv_event_t * event);
+static void lv_hud_expose_children(lv_hud_t * hud, bool exposed);
+
+/**********************
+ *  STATIC VARIABLES
+ **********************/
+const lv_obj_class_t lv_hud_class  = {
+    .constructor_cb = lv_hud_constructor,
+    .event_cb = lv_hud_event,
+    .instance_size = sizeof(lv_hud_t),
+    .base_class = &lv_obj_class,
+};
+
+/**********************
+ *   GLOBAL FUNCTIONS
+ **********************/
+
+lv_obj_t * lv_hud_create(lv_obj_t * parent)
+{
+    lv_obj_t * obj = lv_obj_class_create_obj(MY_CLASS, parent);
+    lv_obj_class_init_obj(obj);
+
+    /*No theme padding or background, the children are placed as they
+     *would be on the parent itself*/
+    lv_obj_remove_style_all(obj);
+    lv_obj_set_size(obj, LV_PCT(100), LV_PCT(100));
+
+    return obj;
+}
+
+/*=====================
+ * Setter functions
+ *====================*/
+
+void lv_hud_set_attitude(lv_obj_t * obj, int32_t heading, int32_t pitch, int16_t roll)
+{
+    LV_ASSERT_OBJ(obj, MY_CLASS);
+    lv_hud_t * hud = (lv_hud_t *)obj;
+
+    /*The children apply their dead-bands and invalidate only what changed,
+     *the tape rows and readout of the compass, the ladder with its extension*/
+    lv_hud_expose_children(hud, true);
+    lv_compass_angle(hud->compass, heading);
+    lv_pitch_ladder_set_angles(hud->pitch_ladder, pitch, roll);
+    lv_hud_expose_children(hud, false);
+}
+
+/*=====================
+ * Getter functions
+ *====================*/
+
+lv_obj_t * lv_hud_get_compass(lv_obj_t * obj)
+{
+    LV_ASSERT_OBJ(obj, MY_CLASS);
+    lv_hud_t * hud = (lv_hud_t *)obj;
+
+    return hud->compass;
+}
+
+lv_obj_t * lv_hud_get_pitch_ladder(lv_obj_t * obj)
+{
+    LV_ASSERT_OBJ(obj, MY_CLASS);
+    lv_hud_t * hud = (lv_hud_t *)obj;
+
+    return hud->pitch_ladder;
+}
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+
+static void lv_hud_constructor(const lv_obj_class_t * class_p, lv_obj_t * obj)
+{
+    LV_UNUSED(class_p);
+    LV_TRACE_OBJ_CREATE("begin");
+
+    lv_hud_t * hud = (lv_hud_t *)obj;
+
+    lv_obj_clear_flag(obj, LV_OBJ_FLAG_SCROLLABLE | LV_OBJ_FLAG_CLICKABLE);
+
+    /*Kept out of the refresh, lv_hud_event() draws them*/
+    hud->pitch_ladder = lv_pitch_ladder_create(obj);
+    hud->compass = lv_compass_create(obj);
+    lv_obj_add_flag(hud->pitch_ladder, LV_OBJ_FLAG_HIDDEN);
+    lv_obj_add_flag(hud->compass, LV_OBJ_FLAG_HIDDEN);
+
+    LV_TRACE_OBJ_CREATE("finished");
+}
+
+static void lv_hud_event(const lv_obj_class_t * class_p, lv_event_t * event)
+{
+    LV_UNUSED(class_p);
+
+    lv_res_t res = lv_obj_event_base(MY_CLASS, event);
+    if(res != LV_RES_OK) return;
+
+    lv_event_code_t event_code = lv_event_get_code(event);
+    lv_obj_t * obj = lv_event_get_current_target(event);
+    lv_hud_t * hud = (lv_hud_t *)obj;
+
+    if(event_code == LV_EVENT_DRAW_MAIN) {
+        lv_draw_ctx_t * draw_ctx = lv_event_get_draw_ctx(event);
+
+        /*One pass, back to front, in the HUD's clip area*/
+        lv_event_send(hud->pitch_ladder, LV_EVENT_DRAW_MAIN, draw_ctx);
+        lv_event_send(hud->compass, LV_EVENT_DRAW_MAIN, draw_ctx);
+    }
+}
+
+/*Hidden only for the refresh. Shown around their setters so their own
+ *invalidation is not dropped, the flag is flipped directly as
+ *lv_obj_clear_flag() would invalidate them whole*/
+static void lv_hud_expose_children(lv_hud_t * hud, bool exposed)
+{
+    if(exposed) {
+        hud->compass->flags &= ~LV_OBJ_FLAG_HIDDEN;
+        hud->pitch_ladder->flags &= ~LV_OBJ_FLAG_HIDDEN;
+    }
+    else {
+        hud->compass->flags |= LV_OBJ_FLAG_HIDDEN;
+        hud->pitch_ladder->flags |= LV_OBJ_FLAG_HIDDEN;
+    }
+}
@@ -28,6 +28,15 @@ SOFTWARE.
  *********************/
 #include <math.h>
 #include <app/lib/lv_pitch_ladder.h>
+#ifdef CONFIG_LV_GLYPH_ATLAS
+#include <app/lib/lv_glyph_atlas.h>
+#endif
+#if defined(CONFIG_LV_PITCH_LADDER_HORIZON_FILL) || defined(CONFIG_LV_PITCH_LADDER_FAST_LINES)
+#include <app/lib/hud_draw.h>
+#endif
+#if defined(CONFIG_LV_PITCH_LADDER_FAST_LINES) && defined(CONFIG_LV_PITCH_LADDER_VECTOR)
+#include <app/lib/hud_draw_lv.h>
+#endif
 
 #include <core/lv_group.h>
 #include <misc/lv_assert.h>
@@ -61,6 +70,22 @@ LOG_MODULE_REGISTER(lv_pitch_ladder, CONFIG_SENSOR_LOG_LEVEL);
 
 #define LV_PITCH_LADDER_NONE 256
 
+/* Canvas the ladder is composed in, 1 bit alpha per pixel */
+#define LV_PITCH_LADDER_CANVAS_STRIDE   ((LV_PITCH_LADDE_CANVAS_WIDTH + 7) / 8)
+#define LV_PITCH_LADDER_CANVAS_SIZE     (LV_PITCH_LADDER_CANVAS_STRIDE * LV_PITCH_LADDE_CANVAS_HEIGHT)
+
+/* Image rotated by the roll, colored by the image recolor style */
+#define LV_PITCH_LADDER_IMG_SIZE        LV_CANVAS_BUF_SIZE_TRUE_COLOR_ALPHA(LV_PITCH_LADDE_CANVAS_WIDTH, \
+                                                                            LV_PITCH_LADDE_CANVAS_HEIGHT)
+
+/* Ladder strip, same format, pitch +90 on top and -90 at the bottom */
+#define LV_PITCH_LADDER_STRIP_RANGE     (90)
+#define LV_PITCH_LADDER_STRIP_HEIGHT    (2 * LV_PITCH_LADDER_STRIP_RANGE * LV_PITCH_LADDER_SPACE / 10 + \
+                                         LV_PITCH_LADDE_CANVAS_HEIGHT)
+
+/* Vector mode, the canvas half diagonal plus its offset, past the object */
+#define LV_PITCH_LADDER_VECTOR_EXT_DRAW (48 + LV_PITCH_LADDER_CANVAS_Y_OFFSET - LV_PITCH_LADDE_CANVAS_WIDTH/2)
+
 #define LV_ATTRIBUTE_IMG_TEST
 
 uint32_t LV_PITCH_EVENT_ROTATE = 0;
@@ -84,6 +109,9 @@ typedef struct _lv_event_dsc_t {
 static void lv_pitch_ladder_constructor(const lv_obj_class_t * class_p, lv_obj_t * obj);
 static void lv_pitch_ladder_destructor(const lv_obj_class_t * class_p, lv_obj_t * obj);
 static void lv_pitch_ladder_event(const lv_obj_class_t * class_p, lv_event_t * event);
+#ifndef CONFIG_LV_PITCH_LADDER_VECTOR
+static void lv_pitch_ladder_async_update(void * data);
+#endif
 
 /**********************
  *  STATIC VARIABLES
@@ -99,6 +127,12 @@ const lv_obj_class_t lv_pitch_ladder_class  = {
     //.name = "pitch_ladder",
 };
 
+#ifdef CONFIG_LV_PITCH_LADDER_STRIP
+/*The ladder looks the same for every instance, only colors differ*/
+static uint8_t strip_buf[LV_PITCH_LADDER_STRIP_HEIGHT * LV_PITCH_LADDER_CANVAS_STRIDE];
+static lv_coord_t strip_line_width = -1;
+#endif
+
 /**********************
  *      MACROS
  **********************/
@@ -139,13 +173,31 @@ void lv_pitch_ladder_set_angles(lv_obj_t * obj, int32_t pitch, int16_t roll)
 
 
     lv_pitch_ladder_t * pitch_ladder = (lv_pitch_ladder_t *)obj;
+
+    int32_t roll_diff = roll - pitch_ladder->roll_angle;
+    if(roll_diff > 1800) roll_diff -= 3600;
+    if(roll_diff < -1800) roll_diff += 3600;
+
+    /*Nothing new to show*/
+    if(pitch_ladder->widget_draw &&
+       LV_ABS(pitch - pitch_ladder->pitch_angle) <= CONFIG_LV_PITCH_LADDER_PITCH_DEADBAND &&
+       LV_ABS(roll_diff) <= CONFIG_LV_PITCH_LADDER_ROLL_DEADBAND) {
+        return;
+    }
+
     pitch_ladder->pitch_angle = pitch;
     pitch_ladder->roll_angle = roll;
     pitch_ladder->widget_draw = true;
-    uint32_t btn_id = 0;
-    lv_event_send((lv_obj_t *)pitch_ladder, LV_PITCH_EVENT_ROTATE, &btn_id);
-    //lv_obj_invalidate(obj);
-    //lv_refr_now(NULL);
+#ifdef CONFIG_LV_PITCH_LADDER_VECTOR
+    lv_obj_invalidate(obj);
+#else
+    /*Render once per LVGL timer run with the latest angles, however
+     *often they are set in between*/
+    if(!pitch_ladder->update_pending) {
+        pitch_ladder->update_pending = true;
+        lv_async_call(lv_pitch_ladder_async_update, obj);
+    }
+#endif
 }
 
 void lv_pitch_ladder_set_dark_style(lv_obj_t * obj)
@@ -158,6 +210,12 @@ void lv_pitch_ladder_set_dark_style(lv_obj_t * obj)
     lv_draw_line_dsc_t *line_dsc = &(pitch_ladder->line_dsc);
     line_dsc->color = lv_color_make(0x00, 0x00, 0xFF);
     pitch_ladder->bg = lv_color_black();
+    pitch_ladder->sky = LV_PITCH_LADDER_DARK_SKY;
+    pitch_ladder->ground = LV_PITCH_LADDER_DARK_GROUND;
+#ifndef CONFIG_LV_PITCH_LADDER_VECTOR
+    lv_obj_set_style_img_recolor(lv_obj_get_child(obj, 0), line_dsc->color, LV_PART_MAIN);
+#endif
+    lv_obj_invalidate(obj);
 }
 
 void lv_pitch_ladder_set_light_style(lv_obj_t * obj)
@@ -170,6 +228,24 @@ void lv_pitch_ladder_set_light_style(lv_obj_t * obj)
     lv_draw_line_dsc_t *line_dsc = &(pitch_ladder->line_dsc);
     line_dsc->color = lv_color_black();
     pitch_ladder->bg = lv_color_white();
+    pitch_ladder->sky = LV_PITCH_LADDER_LIGHT_SKY;
+    pitch_ladder->ground = LV_PITCH_LADDER_LIGHT_GROUND;
+#ifndef CONFIG_LV_PITCH_LADDER_VECTOR
+    lv_obj_set_style_img_recolor(lv_obj_get_child(obj, 0), line_dsc->color, LV_PART_MAIN);
+#endif
+    lv_obj_invalidate(obj);
+}
+void lv_pitch_ladder_set_color(lv_obj_t * obj, lv_color_t color)
+{
+    LV_ASSERT_OBJ(obj, MY_CLASS);
+    lv_pitch_ladder_t * pitch_ladder = (lv_pitch_ladder_t *)obj;
+
+    pitch_ladder->label_dsc.color = color;
+    pitch_ladder->line_dsc.color = color;
+#ifndef CONFIG_LV_PITCH_LADDER_VECTOR
+    lv_obj_set_style_img_recolor(lv_obj_get_child(obj, 0), color, LV_PART_MAIN);
+#endif
+    lv_obj_invalidate(obj);
 }
 void lv_pitch_ladder_set_line_width(lv_obj_t * obj, lv_coord_t width)
 {
@@ -178,6 +254,20 @@ void lv_pitch_ladder_set_line_width(lv_obj_t * obj, lv_coord_t width)
 
     lv_draw_line_dsc_t *line_dsc = &(pitch_ladder->line_dsc);
     line_dsc->width = width;
+#ifdef CONFIG_LV_PITCH_LADDER_VECTOR
+    lv_obj_refresh_ext_draw_size(obj);
+    lv_obj_invalidate(obj);
+#endif
+}
+
+void lv_pitch_ladder_set_horizon_colors(lv_obj_t * obj, lv_color_t sky, lv_color_t ground)
+{
+    LV_ASSERT_OBJ(obj, MY_CLASS);
+    lv_pitch_ladder_t * pitch_ladder = (lv_pitch_ladder_t *)obj;
+
+    pitch_ladder->sky = sky;
+    pitch_ladder->ground = ground;
+    lv_obj_invalidate(obj);
 }
 /*=====================
  * Getter functions
@@ -193,56 +283,147 @@ void lv_pitch_ladder_set_line_width(lv_obj_t * obj, lv_coord_t width)
  *   STATIC FUNCTIONS
  **********************/
 
-static void lv_pitch_ladder_draw_pitch_up( lv_obj_t * obj, int16_t x, int16_t y, int16_t angle)
+/**
+ * Segments of the rung with label value `value`, `y` pixels below the
+ * canvas center: the two halves beside the label gap and, except on the
+ * horizon, the end ticks pointing towards the horizon.
+ * @return number of segments written to `seg`
+ */
+static uint32_t lv_pitch_ladder_rung_segments(int32_t value, lv_coord_t y, lv_point_t seg[][2])
 {
-    const lv_point_t pts[] = { { LV_PITCH_LADDER_LADDER_WDIFF, LV_PITCH_LADDE_CANVAS_HEIGHT/2 + y}, {LV_PITCH_LADDER_HORIZ_LEND, LV_PITCH_LADDE_CANVAS_HEIGHT/2 + y}};
-    const lv_point_t pts1[] = { { LV_PITCH_LADDER_HORIZ_RSTART + LV_PITCH_LADDER_LABEL_W, LV_PITCH_LADDE_CANVAS_HEIGHT/2 + y}, {LV_PITCH_LADDE_CANVAS_WIDTH-1 - LV_PITCH_LADDER_LADDER_WDIFF, LV_PITCH_LADDE_CANVAS_HEIGHT/2 + y}};
-    const lv_point_t pts2[] = { { LV_PITCH_LADDER_LADDER_WDIFF, LV_PITCH_LADDE_CANVAS_HEIGHT/2 + y}, {LV_PITCH_LADDER_LADDER_WDIFF, LV_PITCH_LADDE_CANVAS_HEIGHT/2+LV_PITCH_LADDER_THICK + y}};
-    const lv_point_t pts3[] = { { LV_PITCH_LADDE_CANVAS_WIDTH-1 - LV_PITCH_LADDER_LADDER_WDIFF, LV_PITCH_LADDE_CANVAS_HEIGHT/2 + y}, { LV_PITCH_LADDE_CANVAS_WIDTH-1 - LV_PITCH_LADDER_LADDER_WDIFF, LV_PITCH_LADDE_CANVAS_HEIGHT/2+LV_PITCH_LADDER_THICK + y} };
-    lv_pitch_ladder_t * pitch_ladder = (lv_pitch_ladder_t *)obj;
-    lv_canvas_draw_line(lv_obj_get_child(obj, 0), pts, 2, &(pitch_ladder->line_dsc));
-    lv_canvas_draw_line(lv_obj_get_child(obj, 0), pts1, 2, &(pitch_ladder->line_dsc));
-    lv_canvas_draw_line(lv_obj_get_child(obj, 0), pts2, 2, &(pitch_ladder->line_dsc));
-    lv_canvas_draw_line(lv_obj_get_child(obj, 0), pts3, 2, &(pitch_ladder->line_dsc));
+    const lv_coord_t cy = LV_PITCH_LADDE_CANVAS_HEIGHT/2 + y;
+    const lv_coord_t left = value == 0 ? 0 : LV_PITCH_LADDER_LADDER_WDIFF;
+    const lv_coord_t right = LV_PITCH_LADDE_CANVAS_WIDTH-1 - left;
+    const lv_coord_t tick = value > 0 ? (lv_coord_t)LV_PITCH_LADDER_THICK : -(lv_coord_t)LV_PITCH_LADDER_THICK;
+
+    seg[0][0] = (lv_point_t){left, cy};
+    seg[0][1] = (lv_point_t){LV_PITCH_LADDER_HORIZ_LEND, cy};
+    seg[1][0] = (lv_point_t){LV_PITCH_LADDER_HORIZ_RSTART + LV_PITCH_LADDER_LABEL_W, cy};
+    seg[1][1] = (lv_point_t){right, cy};
+    if(value == 0) return 2;
+
+    seg[2][0] = (lv_point_t){left, cy};
+    seg[2][1] = (lv_point_t){left, cy + tick};
+    seg[3][0] = (lv_point_t){right, cy};
+    seg[3][1] = (lv_point_t){right, cy + tick};
+    return 4;
+}
 
+static void lv_pitch_ladder_aim_segments(lv_point_t seg[2][2])
+{
+    seg[0][0] = (lv_point_t){LV_PITCH_LADDE_CANVAS_WIDTH/2 - LV_PITCH_LADDER_AIM_W/2, LV_PITCH_LADDE_CANVAS_HEIGHT/2};
+    seg[0][1] = (lv_point_t){LV_PITCH_LADDE_CANVAS_WIDTH/2 + LV_PITCH_LADDER_AIM_W/2, LV_PITCH_LADDE_CANVAS_HEIGHT/2};
+    seg[1][0] = (lv_point_t){LV_PITCH_LADDE_CANVAS_WIDTH/2, LV_PITCH_LADDE_CANVAS_HEIGHT/2 - LV_PITCH_LADDER_AIM_W/2};
+    seg[1][1] = (lv_point_t){LV_PITCH_LADDE_CANVAS_WIDTH/2, LV_PITCH_LADDE_CANVAS_HEIGHT/2 + LV_PITCH_LADDER_AIM_W/2};
 }
-static void lv_pitch_ladder_draw_pitch_down( lv_obj_t * obj, int16_t x, int16_t y, int16_t angle)
+
+static void lv_pitch_ladder_label_text(char * buf, size_t size, int32_t value)
 {
-    const lv_point_t pts[] = { { LV_PITCH_LADDER_LADDER_WDIFF, LV_PITCH_LADDE_CANVAS_HEIGHT/2 + y}, {LV_PITCH_LADDER_HORIZ_LEND, LV_PITCH_LADDE_CANVAS_HEIGHT/2 + y}};
-    const lv_point_t pts1[] = { { LV_PITCH_LADDER_HORIZ_RSTART + LV_PITCH_LADDER_LABEL_W, LV_PITCH_LADDE_CANVAS_HEIGHT/2 + y}, {LV_PITCH_LADDE_CANVAS_WIDTH-1 - LV_PITCH_LADDER_LADDER_WDIFF, LV_PITCH_LADDE_CANVAS_HEIGHT/2 + y}};
-    const lv_point_t pts2[] = { { LV_PITCH_LADDER_LADDER_WDIFF, LV_PITCH_LADDE_CANVAS_HEIGHT/2 + y}, {LV_PITCH_LADDER_LADDER_WDIFF, LV_PITCH_LADDE_CANVAS_HEIGHT/2-LV_PITCH_LADDER_THICK + y}};
-    const lv_point_t pts3[] = { { LV_PITCH_LADDE_CANVAS_WIDTH-1 - LV_PITCH_LADDER_LADDER_WDIFF, LV_PITCH_LADDE_CANVAS_HEIGHT/2 + y}, { LV_PITCH_LADDE_CANVAS_WIDTH-1 - LV_PITCH_LADDER_LADDER_WDIFF, LV_PITCH_LADDE_CANVAS_HEIGHT/2 - LV_PITCH_LADDER_THICK + y} };
-    lv_pitch_ladder_t * pitch_ladder = (lv_pitch_ladder_t *)obj;
-    lv_canvas_draw_line(lv_obj_get_child(obj, 0), pts, 2, &(pitch_ladder->line_dsc));
-    lv_canvas_draw_line(lv_obj_get_child(obj, 0), pts1, 2, &(pitch_ladder->line_dsc));
-    lv_canvas_draw_line(lv_obj_get_child(obj, 0), pts2, 2, &(pitch_ladder->line_dsc));
-    lv_canvas_draw_line(lv_obj_get_child(obj, 0), pts3, 2, &(pitch_ladder->line_dsc));
+    if(value >= 0) lv_snprintf(buf, size, " %d", (int16_t)value);
+    else lv_snprintf(buf, size, "%d", (int16_t)value);
+}
+
+/**
+ * Rungs in view for a pitch: the one at or below it and two on each side,
+ * with their offset from the canvas center.
+ */
+static void lv_pitch_ladder_get_ticks(int32_t pitch, lv_pitch_tick_info_t ticks[LV_PITCH_LADDER_ROLL_TICK_RANGE + 1])
+{
+    int32_t yoffset = (pitch%10)*LV_PITCH_LADDER_SPACE/10;
+
+    int scale = LV_PITCH_LADDER_PITCH_SCALE;// tick lenght
+    int tickRange = LV_PITCH_LADDER_ROLL_TICK_RANGE;  // number of ticks
+    int scaleStart = (floor(pitch/scale)*scale-floor(scale*tickRange/2));
 
+    //LOG_INF("yoff = %d, scaleStart = %d", yoffset, scaleStart);
+    for(int i = 0; i < LV_PITCH_LADDER_ROLL_TICK_RANGE + 1; i++){
+        ticks[i].y_offset = (2 - i)*LV_PITCH_LADDER_SPACE + yoffset;
+        ticks[i].label_value = scaleStart + i*LV_PITCH_LADDER_PITCH_SCALE;
+    }
 }
-static void lv_pitch_ladder_draw_horizon( lv_obj_t * obj, int16_t x, int16_t y, int16_t angle)
+
+/*Roll is in 0.1 degrees, the sine table in degrees*/
+static inline int16_t lv_pitch_ladder_roll_deg(int16_t roll)
 {
-    const lv_point_t pts[] = { {0, LV_PITCH_LADDE_CANVAS_HEIGHT/2 + y}, {LV_PITCH_LADDER_HORIZ_LEND, LV_PITCH_LADDE_CANVAS_HEIGHT/2 + y}};
-    const lv_point_t pts1[] = { {LV_PITCH_LADDER_HORIZ_RSTART + LV_PITCH_LADDER_LABEL_W, LV_PITCH_LADDE_CANVAS_HEIGHT/2 + y}, {LV_PITCH_LADDE_CANVAS_WIDTH-1, LV_PITCH_LADDE_CANVAS_HEIGHT/2 + y}};
-    lv_pitch_ladder_t * pitch_ladder = (lv_pitch_ladder_t *)obj;
-    lv_canvas_draw_line(lv_obj_get_child(obj, 0), pts, 2, &(pitch_ladder->line_dsc));
-    lv_canvas_draw_line(lv_obj_get_child(obj, 0), pts1, 2, &(pitch_ladder->line_dsc));
+    return (roll + (roll >= 0 ? 5 : -5)) / 10;
 }
-static void lv_pitch_ladder_draw_aim( lv_obj_t * obj, int16_t x, int16_t y, int16_t angle)
+
+#ifndef CONFIG_LV_PITCH_LADDER_VECTOR
+/**
+ * One line into the 1 bit canvas. With LV_PITCH_LADDER_FAST_LINES the bits
+ * are set directly, without anti-aliasing, which is all a 1 bit canvas can
+ * show anyway.
+ */
+static void lv_pitch_ladder_canvas_line( lv_obj_t * obj, const lv_point_t seg[2])
 {
-    const lv_point_t pts[] = { {LV_PITCH_LADDE_CANVAS_WIDTH/2 - LV_PITCH_LADDER_AIM_W/2, LV_PITCH_LADDE_CANVAS_HEIGHT/2 + y}, {LV_PITCH_LADDE_CANVAS_WIDTH/2 +LV_PITCH_LADDER_AIM_W/2, LV_PITCH_LADDE_CANVAS_HEIGHT/2 + y}};
-    const lv_point_t pts1[] = { {LV_PITCH_LADDE_CANVAS_WIDTH/2, LV_PITCH_LADDE_CANVAS_HEIGHT/2 - LV_PITCH_LADDER_AIM_W/2 +y}, {LV_PITCH_LADDE_CANVAS_WIDTH/2, LV_PITCH_LADDE_CANVAS_HEIGHT/2 + LV_PITCH_LADDER_AIM_W/2 + y}};
     lv_pitch_ladder_t * pitch_ladder = (lv_pitch_ladder_t *)obj;
-    lv_canvas_draw_line(lv_obj_get_child(obj, 0), pts, 2, &(pitch_ladder->line_dsc));
-    lv_canvas_draw_line(lv_obj_get_child(obj, 0), pts1, 2, &(pitch_ladder->line_dsc));
+#ifdef CONFIG_LV_PITCH_LADDER_FAST_LINES
+    struct hud_draw_buf dst = {
+        .buf = pitch_ladder->canvas_buf,
+        .stride = LV_PITCH_LADDE_CANVAS_WIDTH,
+        .width = LV_PITCH_LADDE_CANVAS_WIDTH,
+        .height = LV_PITCH_LADDE_CANVAS_HEIGHT,
+        .format = HUD_DRAW_A1,
+    };
+
+    hud_draw_line(&dst, seg[0].x, seg[0].y, seg[1].x, seg[1].y, pitch_ladder->line_dsc.width, 1);
+#else
+    lv_canvas_draw_line(lv_obj_get_child(obj, 1), seg, 2, &(pitch_ladder->line_dsc));
+#endif
+}
+static void lv_pitch_ladder_draw_rung( lv_obj_t * obj, int16_t y, int32_t value)
+{
+    lv_point_t seg[4][2];
+    uint32_t cnt = lv_pitch_ladder_rung_segments(value, y, seg);
+
+    for(uint32_t i = 0; i < cnt; i++) {
+        lv_pitch_ladder_canvas_line(obj, seg[i]);
+    }
+}
+static void lv_pitch_ladder_draw_aim( lv_obj_t * obj)
+{
+    lv_point_t seg[2][2];
+
+    lv_pitch_ladder_aim_segments(seg);
+    lv_pitch_ladder_canvas_line(obj, seg[0]);
+    lv_pitch_ladder_canvas_line(obj, seg[1]);
+}
+
+/**
+ * Expand the composed 1 bit canvas into the alpha bytes of the image LVGL
+ * rotates. LVGL 8 draws alpha only images line by line and cannot
+ * transform them. The color bytes stay white, the image recolor style
+ * gives the ladder color.
+ */
+static void lv_pitch_ladder_expand( lv_obj_t * obj)
+{
+    lv_pitch_ladder_t * pitch_ladder = (lv_pitch_ladder_t *) obj;
+    const uint8_t * src = pitch_ladder->canvas_buf;
+    uint8_t * alpha = pitch_ladder->img_buf + LV_IMG_PX_SIZE_ALPHA_BYTE - 1;
+
+    for(uint32_t y = 0; y < LV_PITCH_LADDE_CANVAS_HEIGHT; y++) {
+        for(uint32_t x = 0; x < LV_PITCH_LADDE_CANVAS_WIDTH; x++) {
+            *alpha = (src[x >> 3] & (0x80 >> (x & 7))) ? LV_OPA_COVER : LV_OPA_TRANSP;
+            alpha += LV_IMG_PX_SIZE_ALPHA_BYTE;
+        }
+        src += LV_PITCH_LADDER_CANVAS_STRIDE;
+    }
+
+    lv_obj_invalidate(lv_obj_get_child(obj, 0));
 }
 static void lv_pitch_ladder_draw_label( lv_obj_t * obj, int16_t x, int16_t y, int16_t tick_num)
 {
     char buf[8] = {0};
     lv_pitch_ladder_t * pitch_ladder = (lv_pitch_ladder_t *)obj;
-    if(tick_num >= 0) lv_snprintf(buf, sizeof(buf), " %d", (int16_t)tick_num); 
-    else lv_snprintf(buf, sizeof(buf), "%d", (int16_t)tick_num);
-    lv_canvas_draw_text(lv_obj_get_child(obj, 0), LV_PITCH_LADDE_CANVAS_WIDTH/2 + LV_PITCH_LADDER_LABEL_XOFFSET + x, LV_PITCH_LADDE_CANVAS_HEIGHT/2 -LV_PITCH_LADDER_FONT_SIZE/2 +y, 60, &(pitch_ladder->label_dsc), buf);
+    lv_point_t pos = {LV_PITCH_LADDE_CANVAS_WIDTH/2 + LV_PITCH_LADDER_LABEL_XOFFSET + x, LV_PITCH_LADDE_CANVAS_HEIGHT/2 -LV_PITCH_LADDER_FONT_SIZE/2 +y};
+#ifdef CONFIG_LV_GLYPH_ATLAS
+    if(lv_glyph_atlas_draw_int_a1(pitch_ladder->canvas_buf, LV_PITCH_LADDE_CANVAS_WIDTH, LV_PITCH_LADDE_CANVAS_HEIGHT,
+                                  &(pitch_ladder->label_dsc), &pos, tick_num, true) == LV_RES_OK) return;
+#endif
+    lv_pitch_ladder_label_text(buf, sizeof(buf), tick_num);
+    lv_canvas_draw_text(lv_obj_get_child(obj, 1), pos.x, pos.y, 60, &(pitch_ladder->label_dsc), buf);
 }
+#endif
 
 static void lv_pitch_ladder_constructor(const lv_obj_class_t * class_p, lv_obj_t * obj)
 {
@@ -263,20 +444,41 @@ static void lv_pitch_ladder_constructor(const lv_obj_class_t * class_p, lv_obj_t
     pitch_ladder->pitch_angle = 0;
     pitch_ladder->txt_src = NULL;
     pitch_ladder->widget_draw = false;
+    pitch_ladder->update_pending = false;
+    pitch_ladder->sky = LV_PITCH_LADDER_DARK_SKY;
+    pitch_ladder->ground = LV_PITCH_LADDER_DARK_GROUND;
 
     LV_PITCH_EVENT_ROTATE = lv_event_register_id();
+#ifdef CONFIG_LV_PITCH_LADDER_VECTOR
+    /*Drawn in LV_EVENT_DRAW_MAIN, no canvas*/
+    pitch_ladder->canvas_buf = NULL;
+    pitch_ladder->img_buf = NULL;
+#else
+    /*Child 0 is the image rotated by the roll, child 1 the hidden 1 bit
+     *canvas the ladder is composed in and expanded from*/
     lv_obj_t *canvas = lv_canvas_create(obj);
+    lv_obj_t *compose = lv_canvas_create(obj);
 
-    static lv_color_t buffer[3*LV_PITCH_LADDE_CANVAS_WIDTH*LV_PITCH_LADDE_CANVAS_HEIGHT];
-    lv_canvas_set_buffer(canvas, buffer,LV_PITCH_LADDE_CANVAS_WIDTH, LV_PITCH_LADDE_CANVAS_HEIGHT, LV_IMG_CF_TRUE_COLOR_ALPHA);
+    pitch_ladder->img_buf = lv_mem_alloc(LV_PITCH_LADDER_IMG_SIZE);
+    LV_ASSERT_MALLOC(pitch_ladder->img_buf);
+    lv_canvas_set_buffer(canvas, pitch_ladder->img_buf, LV_PITCH_LADDE_CANVAS_WIDTH, LV_PITCH_LADDE_CANVAS_HEIGHT, LV_IMG_CF_TRUE_COLOR_ALPHA);
     lv_obj_align(canvas, LV_ALIGN_CENTER, LV_PITCH_LADDER_CANVAS_X_OFFSET, LV_PITCH_LADDER_CANVAS_Y_OFFSET);
+    /*The ladder color is applied as image recolor while blending*/
+    lv_obj_set_style_img_recolor_opa(canvas, LV_OPA_COVER, LV_PART_MAIN);
+    lv_canvas_fill_bg(canvas, lv_color_white(), LV_OPA_TRANSP);
 
-    //lv_color_t c = lv_color_make(0xFF, 0xFF, 0xFF);
-    //lv_color_t c = lv_color_make(0x00, 0xFF, 0x00);
-    lv_canvas_fill_bg(lv_obj_get_child(obj, 0), pitch_ladder->bg, LV_OPA_COVER); 
+    pitch_ladder->canvas_buf = lv_mem_alloc(LV_PITCH_LADDER_CANVAS_SIZE);
+    LV_ASSERT_MALLOC(pitch_ladder->canvas_buf);
+    lv_canvas_set_buffer(compose, pitch_ladder->canvas_buf, LV_PITCH_LADDE_CANVAS_WIDTH, LV_PITCH_LADDE_CANVAS_HEIGHT, LV_IMG_CF_ALPHA_1BIT);
+    lv_obj_add_flag(compose, LV_OBJ_FLAG_HIDDEN);
+    lv_canvas_fill_bg(compose, pitch_ladder->bg, LV_OPA_TRANSP);
+#endif
 
     lv_draw_label_dsc_init(&(pitch_ladder->label_dsc));
     lv_draw_line_dsc_init(&(pitch_ladder->line_dsc));
+#ifdef CONFIG_LV_GLYPH_ATLAS
+    lv_glyph_atlas_init(pitch_ladder->label_dsc.font);
+#endif
 
     //lv_obj_set_style_bg_color((lv_obj_t *)pitch_ladder, lv_color_hex(0xFF0000), LV_PART_MAIN);
 
@@ -296,45 +498,264 @@ static void lv_pitch_ladder_destructor(const lv_obj_class_t * class_p, lv_obj_t
     }
     _lv_ll_clear(&pitch_ladder->section_ll);
 
+#ifndef CONFIG_LV_PITCH_LADDER_VECTOR
+    if(pitch_ladder->update_pending) {
+        lv_async_call_cancel(lv_pitch_ladder_async_update, obj);
+    }
+#endif
+
+    lv_mem_free(pitch_ladder->canvas_buf);
+    pitch_ladder->canvas_buf = NULL;
+    lv_mem_free(pitch_ladder->img_buf);
+    pitch_ladder->img_buf = NULL;
+
     LV_TRACE_OBJ_CREATE("finished");
 }
 
-static void lv_pitch_ladder_redraw( lv_obj_t * obj, lv_event_t * event)
+#ifndef CONFIG_LV_PITCH_LADDER_VECTOR
+static void lv_pitch_ladder_draw_scale( lv_obj_t * obj, int32_t pitch)
+{
+    lv_pitch_tick_info_t scaleValues[LV_PITCH_LADDER_ROLL_TICK_RANGE + 1];
+
+    lv_pitch_ladder_get_ticks(pitch, scaleValues);
+
+    for(int i = 0; i < LV_PITCH_LADDER_ROLL_TICK_RANGE + 1; i++){
+        lv_pitch_ladder_draw_label(obj, 0, scaleValues[i].y_offset, scaleValues[i].label_value);
+        lv_pitch_ladder_draw_rung(obj, scaleValues[i].y_offset, scaleValues[i].label_value);
+    }
+}
+#endif
+
+#ifdef CONFIG_LV_PITCH_LADDER_STRIP
+/**
+ * Render the ladder from +90 to -90 into the strip: draw the canvas at
+ * every 10 degrees and copy the rows around its center.
+ */
+static void lv_pitch_ladder_render_strip( lv_obj_t * obj)
 {
     lv_pitch_ladder_t * pitch_ladder = (lv_pitch_ladder_t *) obj;
+    lv_obj_t * canvas = lv_obj_get_child(obj, 1);
+    const lv_coord_t center = LV_PITCH_LADDE_CANVAS_HEIGHT/2;
 
-    //lv_color_t c = lv_color_make(0xFF, 0x00, 0x00);
-    lv_canvas_fill_bg(lv_obj_get_child(obj, 0), pitch_ladder->bg, LV_OPA_COVER); 
-    int32_t yoffset = (pitch_ladder->pitch_angle%10)*LV_PITCH_LADDER_SPACE/10;
+    for(int32_t pitch = LV_PITCH_LADDER_STRIP_RANGE; pitch >= -LV_PITCH_LADDER_STRIP_RANGE;
+        pitch -= LV_PITCH_LADDER_PITCH_SCALE) {
+        int32_t row0 = (LV_PITCH_LADDER_STRIP_RANGE - pitch)*LV_PITCH_LADDER_SPACE/10;
+        lv_coord_t y_start = center - LV_PITCH_LADDER_SPACE/2;
+        lv_coord_t y_end = center + LV_PITCH_LADDER_SPACE/2;
 
-    int scale = LV_PITCH_LADDER_PITCH_SCALE;// tick lenght
-    int tickRange = LV_PITCH_LADDER_ROLL_TICK_RANGE;  // number of ticks
-    int scaleStart = (floor(pitch_ladder->pitch_angle/scale)*scale-floor(scale*tickRange/2));
+        /*The outermost pages also cover the rows above and below*/
+        if(pitch == LV_PITCH_LADDER_STRIP_RANGE) y_start = 0;
+        if(pitch == -LV_PITCH_LADDER_STRIP_RANGE) y_end = LV_PITCH_LADDE_CANVAS_HEIGHT;
 
-    //LOG_INF("yoff = %d, scaleStart = %d", yoffset, scaleStart);
-    lv_pitch_tick_info_t scaleValues[LV_PITCH_LADDER_ROLL_TICK_RANGE + 1] = {
-        {.y_offset = LV_PITCH_LADDER_SPACE*2 + yoffset, .label_value = scaleStart},
-        {.y_offset = LV_PITCH_LADDER_SPACE + yoffset, .label_value = scaleStart + LV_PITCH_LADDER_PITCH_SCALE},
-        {.y_offset = yoffset, .label_value = scaleStart + 2*LV_PITCH_LADDER_PITCH_SCALE},
-        {.y_offset = -LV_PITCH_LADDER_SPACE + yoffset, .label_value = scaleStart + 3*LV_PITCH_LADDER_PITCH_SCALE},
-        {.y_offset = -LV_PITCH_LADDER_SPACE*2 + yoffset, .label_value = scaleStart + 4*LV_PITCH_LADDER_PITCH_SCALE}
-    };
+        lv_canvas_fill_bg(canvas, pitch_ladder->bg, LV_OPA_TRANSP);
+        lv_pitch_ladder_draw_scale(obj, pitch);
+
+        lv_memcpy(&strip_buf[(row0 + y_start) * LV_PITCH_LADDER_CANVAS_STRIDE],
+                  &pitch_ladder->canvas_buf[y_start * LV_PITCH_LADDER_CANVAS_STRIDE],
+                  (y_end - y_start) * LV_PITCH_LADDER_CANVAS_STRIDE);
+    }
+
+    strip_line_width = pitch_ladder->line_dsc.width;
+}
+
+/**
+ * Copy the strip window for the current pitch into the canvas, the cost
+ * does not depend on how many rungs and labels are in view.
+ */
+static void lv_pitch_ladder_blit_strip( lv_obj_t * obj)
+{
+    lv_pitch_ladder_t * pitch_ladder = (lv_pitch_ladder_t *) obj;
+    int32_t pitch = LV_CLAMP(-LV_PITCH_LADDER_STRIP_RANGE, pitch_ladder->pitch_angle,
+                             LV_PITCH_LADDER_STRIP_RANGE);
+    int32_t row0 = (LV_PITCH_LADDER_STRIP_RANGE - pitch)*LV_PITCH_LADDER_SPACE/10;
+
+    if(strip_line_width != pitch_ladder->line_dsc.width) {
+        lv_pitch_ladder_render_strip(obj);
+    }
+
+    lv_memcpy(pitch_ladder->canvas_buf, &strip_buf[row0 * LV_PITCH_LADDER_CANVAS_STRIDE],
+              LV_PITCH_LADDER_CANVAS_SIZE);
+}
+#endif
+
+#ifdef CONFIG_LV_PITCH_LADDER_VECTOR
+/**
+ * Clip an axis aligned canvas segment to the canvas, so the vector ladder
+ * shows the same window the canvas does.
+ * @return false if nothing is left
+ */
+static bool lv_pitch_ladder_clip(lv_point_t seg[2])
+{
+    const lv_area_t canvas = {0, 0, LV_PITCH_LADDE_CANVAS_WIDTH - 1, LV_PITCH_LADDE_CANVAS_HEIGHT - 1};
+    lv_area_t a;
+
+    a.x1 = LV_MIN(seg[0].x, seg[1].x);
+    a.y1 = LV_MIN(seg[0].y, seg[1].y);
+    a.x2 = LV_MAX(seg[0].x, seg[1].x);
+    a.y2 = LV_MAX(seg[0].y, seg[1].y);
+    if(!_lv_area_intersect(&a, &a, &canvas)) return false;
+
+    seg[0] = (lv_point_t){a.x1, a.y1};
+    seg[1] = (lv_point_t){a.x2, a.y2};
+    return true;
+}
+
+/**
+ * Map a canvas point to the screen, rotated by the roll angle around the
+ * canvas center like lv_img_set_angle() would. sn and cs are the sine and
+ * cosine scaled by 1 << LV_TRIGO_SHIFT.
+ */
+static void lv_pitch_ladder_rotate(const lv_point_t * pivot, int32_t sn, int32_t cs, lv_point_t * p)
+{
+    int32_t dx = p->x - (lv_coord_t)(LV_PITCH_LADDE_CANVAS_WIDTH/2);
+    int32_t dy = p->y - (lv_coord_t)(LV_PITCH_LADDE_CANVAS_HEIGHT/2);
+    const int32_t half = 1 << (LV_TRIGO_SHIFT - 1);
+
+    p->x = pivot->x + ((dx * cs - dy * sn + half) >> LV_TRIGO_SHIFT);
+    p->y = pivot->y + ((dx * sn + dy * cs + half) >> LV_TRIGO_SHIFT);
+}
+
+static inline void lv_pitch_ladder_vector_line(lv_draw_ctx_t * draw_ctx, const lv_draw_line_dsc_t * dsc,
+                                               const lv_point_t * a, const lv_point_t * b)
+{
+#ifdef CONFIG_LV_PITCH_LADDER_FAST_LINES
+    hud_draw_lv_line(draw_ctx, dsc, a, b);
+#else
+    lv_draw_line(draw_ctx, dsc, a, b);
+#endif
+}
+
+/**
+ * Draw the ladder straight into the draw context: rung and aim endpoints
+ * are rotated, labels are placed at their rotated anchor and kept upright.
+ * No canvas and no image transform is involved.
+ */
+static void lv_pitch_ladder_draw_vector( lv_obj_t * obj, lv_event_t * event)
+{
+    lv_pitch_ladder_t * pitch_ladder = (lv_pitch_ladder_t *) obj;
+    lv_draw_ctx_t * draw_ctx = lv_event_get_draw_ctx(event);
+    lv_pitch_tick_info_t ticks[LV_PITCH_LADDER_ROLL_TICK_RANGE + 1];
+    lv_point_t seg[4][2];
+    lv_point_t pivot;
+    char buf[8];
+
+    int16_t deg = lv_pitch_ladder_roll_deg(pitch_ladder->roll_angle);
+    int32_t sn = lv_trigo_sin(deg);
+    int32_t cs = lv_trigo_cos(deg);
+
+    pivot.x = obj->coords.x1 + lv_obj_get_width(obj)/2 + (lv_coord_t)LV_PITCH_LADDER_CANVAS_X_OFFSET;
+    pivot.y = obj->coords.y1 + lv_obj_get_height(obj)/2 + (lv_coord_t)LV_PITCH_LADDER_CANVAS_Y_OFFSET;
+
+    lv_pitch_ladder_get_ticks(pitch_ladder->pitch_angle, ticks);
 
     for(int i = 0; i < LV_PITCH_LADDER_ROLL_TICK_RANGE + 1; i++){
-        lv_pitch_ladder_draw_label(obj, 0, scaleValues[i].y_offset, scaleValues[i].label_value);
-        if(scaleValues[i].label_value == 0){
-            lv_pitch_ladder_draw_horizon(obj, 0, scaleValues[i].y_offset, 0);
-        }
-        if(scaleValues[i].label_value > 0){
-            lv_pitch_ladder_draw_pitch_up(obj, 0, scaleValues[i].y_offset, 0);
-        }
-        if(scaleValues[i].label_value < 0){
-            lv_pitch_ladder_draw_pitch_down(obj, 0, scaleValues[i].y_offset, 0);
+        uint32_t cnt = lv_pitch_ladder_rung_segments(ticks[i].label_value, ticks[i].y_offset, seg);
+
+        for(uint32_t s = 0; s < cnt; s++) {
+            if(!lv_pitch_ladder_clip(seg[s])) continue;
+            lv_pitch_ladder_rotate(&pivot, sn, cs, &seg[s][0]);
+            lv_pitch_ladder_rotate(&pivot, sn, cs, &seg[s][1]);
+            lv_pitch_ladder_vector_line(draw_ctx, &(pitch_ladder->line_dsc), &seg[s][0], &seg[s][1]);
         }
+
+        /*Only labels the canvas would show in full*/
+        lv_coord_t top = LV_PITCH_LADDE_CANVAS_HEIGHT/2 - LV_PITCH_LADDER_FONT_SIZE/2 + ticks[i].y_offset;
+        if(top < 0 || top + (lv_coord_t)LV_PITCH_LADDER_FONT_SIZE > (lv_coord_t)LV_PITCH_LADDE_CANVAS_HEIGHT) continue;
+
+        lv_point_t anchor = {LV_PITCH_LADDE_CANVAS_WIDTH/2 + LV_PITCH_LADDER_LABEL_XOFFSET,
+                             LV_PITCH_LADDE_CANVAS_HEIGHT/2 + ticks[i].y_offset};
+        lv_area_t label_coords;
+
+        lv_pitch_ladder_rotate(&pivot, sn, cs, &anchor);
+        label_coords.x1 = anchor.x;
+        label_coords.y1 = anchor.y - LV_PITCH_LADDER_FONT_SIZE/2;
+        label_coords.x2 = label_coords.x1 + 60 - 1;
+        label_coords.y2 = label_coords.y1 + lv_font_get_line_height(pitch_ladder->label_dsc.font) - 1;
+
+#ifdef CONFIG_LV_GLYPH_ATLAS
+        lv_point_t pos = {label_coords.x1, label_coords.y1};
+        if(lv_glyph_atlas_draw_int(draw_ctx, &(pitch_ladder->label_dsc), &pos, ticks[i].label_value,
+                                   true) == LV_RES_OK) continue;
+#endif
+        lv_pitch_ladder_label_text(buf, sizeof(buf), ticks[i].label_value);
+        lv_draw_label(draw_ctx, &(pitch_ladder->label_dsc), &label_coords, buf, NULL);
     }
-    lv_pitch_ladder_draw_aim(obj, 0, 0, 0);
-    
+
+    lv_pitch_ladder_aim_segments(seg);
+    for(uint32_t s = 0; s < 2; s++) {
+        lv_pitch_ladder_rotate(&pivot, sn, cs, &seg[s][0]);
+        lv_pitch_ladder_rotate(&pivot, sn, cs, &seg[s][1]);
+        lv_pitch_ladder_vector_line(draw_ctx, &(pitch_ladder->line_dsc), &seg[s][0], &seg[s][1]);
+    }
+}
+#else
+static void lv_pitch_ladder_redraw( lv_obj_t * obj, lv_event_t * event)
+{
+#ifdef CONFIG_LV_PITCH_LADDER_STRIP
+    lv_pitch_ladder_blit_strip(obj);
+#else
+    lv_pitch_ladder_t * pitch_ladder = (lv_pitch_ladder_t *) obj;
+
+    //lv_color_t c = lv_color_make(0xFF, 0x00, 0x00);
+    lv_canvas_fill_bg(lv_obj_get_child(obj, 1), pitch_ladder->bg, LV_OPA_TRANSP); 
+    lv_pitch_ladder_draw_scale(obj, pitch_ladder->pitch_angle);
+#endif
+    lv_pitch_ladder_draw_aim(obj);
+    lv_pitch_ladder_expand(obj);
 }
+
+/**
+ * Deferred from lv_pitch_ladder_set_angles(), runs before the display
+ * refresh of the same lv_timer_handler() call.
+ */
+static void lv_pitch_ladder_async_update(void * data)
+{
+    lv_obj_t * obj = data;
+    lv_pitch_ladder_t * pitch_ladder = (lv_pitch_ladder_t *)obj;
+    uint32_t btn_id = 0;
+
+    pitch_ladder->update_pending = false;
+    lv_event_send(obj, LV_PITCH_EVENT_ROTATE, &btn_id);
+#ifdef CONFIG_LV_PITCH_LADDER_HORIZON_FILL
+    /*The fill covers more than the rotated canvas*/
+    lv_obj_invalidate(obj);
+#endif
+}
+#endif
+
+#ifdef CONFIG_LV_PITCH_LADDER_HORIZON_FILL
+/**
+ * Fill the object with sky and ground behind the ladder, split where the
+ * horizon rung is. Written straight into the draw buffer, one or two
+ * spans per row, children like the canvas are drawn on top.
+ */
+static void lv_pitch_ladder_draw_horizon_fill( lv_obj_t * obj, lv_event_t * event)
+{
+    lv_pitch_ladder_t * pitch_ladder = (lv_pitch_ladder_t *) obj;
+    lv_draw_ctx_t * draw_ctx = lv_event_get_draw_ctx(event);
+    int32_t pitch = pitch_ladder->pitch_angle;
+    int16_t deg = lv_pitch_ladder_roll_deg(pitch_ladder->roll_angle);
+    struct hud_horizon hz;
+    lv_area_t area;
+
+    if(!_lv_area_intersect(&area, &obj->coords, draw_ctx->clip_area)) return;
+
+    hz.cx = obj->coords.x1 + lv_obj_get_width(obj)/2 + (lv_coord_t)LV_PITCH_LADDER_CANVAS_X_OFFSET;
+    hz.cy = obj->coords.y1 + lv_obj_get_height(obj)/2 + (lv_coord_t)LV_PITCH_LADDER_CANVAS_Y_OFFSET;
+    hz.offset = (pitch/10)*LV_PITCH_LADDER_SPACE + (pitch%10)*LV_PITCH_LADDER_SPACE/10;
+    hz.sin = lv_trigo_sin(deg);
+    hz.cos = lv_trigo_cos(deg);
+    hz.sky = pitch_ladder->sky.full;
+    hz.ground = pitch_ladder->ground.full;
+
+    lv_coord_t stride = lv_area_get_width(draw_ctx->buf_area);
+    lv_color_t * buf = (lv_color_t *)draw_ctx->buf;
+    buf += (area.y1 - draw_ctx->buf_area->y1) * stride + (area.x1 - draw_ctx->buf_area->x1);
+
+    hud_draw_horizon((uint16_t *)buf, stride, area.x1, area.y1,
+                     lv_area_get_width(&area), lv_area_get_height(&area), &hz);
+}
+#endif
 static void lv_pitch_ladder_event(const lv_obj_class_t * class_p, lv_event_t * event)
 {
     LV_UNUSED(class_p);
@@ -349,11 +770,19 @@ static void lv_pitch_ladder_event(const lv_obj_class_t * class_p, lv_event_t * e
     lv_pitch_ladder_t * pitch_ladder = (lv_pitch_ladder_t *) obj;
     LV_UNUSED(pitch_ladder);
   
+#ifndef CONFIG_LV_PITCH_LADDER_VECTOR
     if(event_code == LV_PITCH_EVENT_ROTATE) {
         lv_img_set_angle(lv_obj_get_child(obj, 0), pitch_ladder->roll_angle);
         lv_pitch_ladder_redraw(obj, event);
     }
+#endif
     if(event_code == LV_EVENT_DRAW_MAIN) {
+#ifdef CONFIG_LV_PITCH_LADDER_HORIZON_FILL
+        lv_pitch_ladder_draw_horizon_fill(obj, event);
+#endif
+#ifdef CONFIG_LV_PITCH_LADDER_VECTOR
+        lv_pitch_ladder_draw_vector(obj, event);
+#endif
         //lv_draw_ctx_t *layer = lv_event_get_draw_ctx(event);
         //lv_canvas_fill_bg(obj, pitch_ladder->bg, LV_OPA_COVER);
         //lv_obj_set_style_bg_color(obj, lv_color_hex(0x00FF00), LV_PART_MAIN);
@@ -362,7 +791,10 @@ static void lv_pitch_ladder_event(const lv_obj_class_t * class_p, lv_event_t * e
 
     }
     else if(event_code == LV_EVENT_REFR_EXT_DRAW_SIZE) {
-
+#ifdef CONFIG_LV_PITCH_LADDER_VECTOR
+        // NOTE: The rotated canvas corners reach past the object
+        lv_event_set_ext_draw_size(event, LV_PITCH_LADDER_VECTOR_EXT_DRAW + pitch_ladder->line_dsc.width);
+#endif
     }
     else {
 
@@ -0,0 +1,132 @@
+#!/usr/bin/env python3
+# Copyright (c) 2024 kristosb
+# SPDX-License-Identifier: Apache-2.0
+
+"""
+Encode an LVGL image source file as an st7735s boot splash.
+
+The RGB565 block of an LVGL C image (LV_COLOR_DEPTH 16, not swapped) is
+blended over the background color and run length encoded as
+(run length - 1, RGB565 big endian) triplets, the layout of
+struct st7735s_splash. The result is a C file defining
+st7735s_boot_splash().
+
+    gen_st7735s_splash.py lib/lv_pitch_ladder/assets/img_lvgl_logo.c \\
+        drivers/display/st7735s/display_st7735s_splash.c
+"""
+
+import argparse
+import re
+import sys
+
+HEADER = """\
+/*
+ * Copyright (c) 2024 kristosb
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/*
+ * Default boot splash, generated by scripts/gen_st7735s_splash.py from
+ * {source}. Do not edit.
+ */
+
+#include <app/drivers/display/display_st7735s.h>
+
+#include <zephyr/toolchain.h>
+
+static const uint8_t st7735s_splash_rle[] = {{
+{data}
+}};
+
+static const struct st7735s_splash st7735s_splash = {{
+\t.width = {width},
+\t.height = {height},
+\t.bg = 0x{bg:04x},
+\t.rle = st7735s_splash_rle,
+\t.rle_len = sizeof(st7735s_splash_rle),
+}};
+
+__weak const struct st7735s_splash *st7735s_boot_splash(const struct device *dev)
+{{
+\tARG_UNUSED(dev);
+
+\treturn &st7735s_splash;
+}}
+"""
+
+
+def parse_image(text):
+    block = re.search(r"#if LV_COLOR_DEPTH == 16 && LV_COLOR_16_SWAP == 0\n"
+                      r"(.*?)#endif", text, re.S)
+    if block is None:
+        sys.exit("no unswapped RGB565 block found")
+
+    body = re.sub(r"/\*.*?\*/", "", block.group(1), flags=re.S)
+    raw = [int(v, 16) for v in re.findall(r"0x[0-9a-fA-F]{2}", body)]
+    width = int(re.search(r"\.header\.w\s*=\s*(\d+)", text).group(1))
+    height = int(re.search(r"\.header\.h\s*=\s*(\d+)", text).group(1))
+
+    if len(raw) != width * height * 3:
+        sys.exit(f"expected {width * height * 3} bytes, got {len(raw)}")
+
+    return width, height, raw
+
+
+def blend(c, bg, alpha):
+    def ch(v, shift, bits):
+        return (v >> shift) & ((1 << bits) - 1)
+
+    out = 0
+    for shift, bits in ((11, 5), (5, 6), (0, 5)):
+        f = ch(c, shift, bits)
+        b = ch(bg, shift, bits)
+        out |= ((f * alpha + b * (255 - alpha) + 127) // 255) << shift
+
+    return out
+
+
+def encode(pixels):
+    out = []
+    i = 0
+    while i < len(pixels):
+        run = 1
+        while (i + run < len(pixels) and run < 256 and
+               pixels[i + run] == pixels[i]):
+            run += 1
+        out += [run - 1, pixels[i] >> 8, pixels[i] & 0xff]
+        i += run
+
+    return out
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.split("\n\n")[0])
+    parser.add_argument("image", help="LVGL image C file")
+    parser.add_argument("output", help="C file to write")
+    parser.add_argument("--bg", type=lambda v: int(v, 0), default=0x0000,
+                        help="RGB565 background, default black")
+    args = parser.parse_args()
+
+    with open(args.image) as f:
+        width, height, raw = parse_image(f.read())
+
+    pixels = [blend(raw[i] | raw[i + 1] << 8, args.bg, raw[i + 2])
+              for i in range(0, len(raw), 3)]
+    rle = encode(pixels)
+
+    lines = []
+    for i in range(0, len(rle), 12):
+        lines.append("\t" + " ".join(f"0x{b:02x}," for b in rle[i:i + 12]))
+
+    with open(args.output, "w") as f:
+        f.write(HEADER.format(source=args.image.replace("\\", "/"),
+                              data="\n".join(lines), width=width,
+                              height=height, bg=args.bg))
+
+    print(f"{width}x{height}: {len(rle)} bytes, "
+          f"{width * height * 2} uncompressed")
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,600 @@
+/*
+ * Copyright (c) 2024 kristosb
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/*
+ * @file test st7735s display driver
+ *
+ * This suite drives the st7735s driver against the panel emulator and
+ * checks both what ends up in frame memory and how many bytes and
+ * transactions it took to get there.
+ */
+
+#include <zephyr/ztest.h>
+#include <zephyr/device.h>
+#include <zephyr/drivers/display.h>
+#include <zephyr/drivers/emul.h>
+#include <zephyr/drivers/gpio.h>
+#include <zephyr/drivers/gpio/gpio_emul.h>
+#include <zephyr/sys/byteorder.h>
+#include <zephyr/toolchain.h>
+
+#include <app/drivers/display/display_st7735s.h>
+#include <app/drivers/display/emul_st7735s.h>
+
+#define PANEL_X_OFFSET 2
+#define PANEL_Y_OFFSET 1
+
+static const struct device *const dev = DEVICE_DT_GET(DT_NODELABEL(st7735s));
+static const struct emul *const emul = EMUL_DT_GET(DT_NODELABEL(st7735s));
+static const struct device *const dev_b =
+	DEVICE_DT_GET(DT_NODELABEL(st7735s_b));
+static const struct emul *const emul_b = EMUL_DT_GET(DT_NODELABEL(st7735s_b));
+#if DT_NODE_EXISTS(DT_NODELABEL(st7735s_c))
+/* 12-bit panel, only present in the RGB444 variant */
+static const struct device *const dev_c =
+	DEVICE_DT_GET(DT_NODELABEL(st7735s_c));
+static const struct emul *const emul_c = EMUL_DT_GET(DT_NODELABEL(st7735s_c));
+#endif
+
+static uint8_t pixels[16 * 8 * 2];
+
+/* Pixels in the byte order the driver is configured to accept */
+static void put_pixel(uint16_t color, uint8_t *dst)
+{
+	if (IS_ENABLED(CONFIG_ST7735S_SWAP_RGB565)) {
+		UNALIGNED_PUT(color, (uint16_t *)dst);
+	} else {
+		sys_put_be16(color, dst);
+	}
+}
+
+static void fill_pattern(uint16_t width, uint16_t height, uint16_t pitch)
+{
+	for (uint16_t y = 0; y < height; y++) {
+		for (uint16_t x = 0; x < pitch; x++) {
+			put_pixel((y << 8) | x, &pixels[(y * pitch + x) * 2]);
+		}
+	}
+}
+
+ZTEST(st7735s, test_write_window)
+{
+	struct display_buffer_descriptor desc = {
+		.buf_size = sizeof(pixels),
+		.width = 4,
+		.height = 3,
+		.pitch = 4,
+	};
+	struct st7735s_emul_stats stats;
+
+	Z_TEST_SKIP_IFDEF(CONFIG_ST7735S_PIXEL_DOUBLING);
+
+	fill_pattern(desc.width, desc.height, desc.pitch);
+	zassert_ok(display_write(dev, 10, 20, &desc, pixels));
+
+	for (uint16_t y = 0; y < desc.height; y++) {
+		for (uint16_t x = 0; x < desc.width; x++) {
+			zassert_equal(st7735s_emul_get_pixel(emul,
+					PANEL_X_OFFSET + 10 + x,
+					PANEL_Y_OFFSET + 20 + y),
+				      (y << 8) | x, "pixel %u,%u", x, y);
+		}
+	}
+
+	st7735s_emul_get_stats(emul, &stats);
+	zassert_equal(stats.windows, 1);
+	zassert_equal(stats.cmd_bytes, 3, "CASET, RASET and RAMWR expected");
+	zassert_equal(stats.param_bytes, 8);
+	zassert_equal(stats.pixel_bytes, 4 * 3 * 2);
+	zassert_equal(stats.pixels, 4 * 3);
+	zassert_equal(stats.transactions, 6);
+	zassert_equal(stats.dc_toggles, 5);
+}
+
+ZTEST(st7735s, test_write_pitch)
+{
+	struct display_buffer_descriptor desc = {
+		.buf_size = sizeof(pixels),
+		.width = 4,
+		.height = 3,
+		.pitch = 16,
+	};
+	struct st7735s_emul_stats stats;
+
+	Z_TEST_SKIP_IFDEF(CONFIG_ST7735S_PIXEL_DOUBLING);
+
+	fill_pattern(desc.width, desc.height, desc.pitch);
+	zassert_ok(display_write(dev, 0, 0, &desc, pixels));
+
+	for (uint16_t y = 0; y < desc.height; y++) {
+		for (uint16_t x = 0; x < desc.width; x++) {
+			zassert_equal(st7735s_emul_get_pixel(emul,
+					PANEL_X_OFFSET + x, PANEL_Y_OFFSET + y),
+				      (y << 8) | x, "pixel %u,%u", x, y);
+		}
+	}
+
+	st7735s_emul_get_stats(emul, &stats);
+	zassert_equal(stats.pixel_bytes, 4 * 3 * 2,
+		      "padding beyond the width must not be sent");
+}
+
+ZTEST(st7735s, test_orientation)
+{
+	struct display_buffer_descriptor desc = {
+		.buf_size = sizeof(pixels),
+		.width = 1,
+		.height = 1,
+		.pitch = 1,
+	};
+	struct display_capabilities caps;
+
+	Z_TEST_SKIP_IFDEF(CONFIG_ST7735S_PIXEL_DOUBLING);
+
+	zassert_ok(display_set_orientation(dev, DISPLAY_ORIENTATION_ROTATED_90));
+	display_get_capabilities(dev, &caps);
+	zassert_equal(caps.current_orientation, DISPLAY_ORIENTATION_ROTATED_90);
+
+	/* Logical top left ends up at the physical top right */
+	put_pixel(0xf800, pixels);
+	zassert_ok(display_write(dev, 0, 0, &desc, pixels));
+	zassert_equal(st7735s_emul_get_pixel(emul, PANEL_X_OFFSET + 127,
+					     PANEL_Y_OFFSET), 0xf800);
+
+	zassert_ok(display_set_orientation(dev, DISPLAY_ORIENTATION_ROTATED_180));
+	put_pixel(0x07e0, pixels);
+	zassert_ok(display_write(dev, 0, 0, &desc, pixels));
+	zassert_equal(st7735s_emul_get_pixel(emul, PANEL_X_OFFSET + 127,
+					     PANEL_Y_OFFSET + 127), 0x07e0);
+
+	zassert_ok(display_set_orientation(dev, DISPLAY_ORIENTATION_ROTATED_270));
+	put_pixel(0x001f, pixels);
+	zassert_ok(display_write(dev, 0, 0, &desc, pixels));
+	zassert_equal(st7735s_emul_get_pixel(emul, PANEL_X_OFFSET,
+					     PANEL_Y_OFFSET + 127), 0x001f);
+
+	zassert_ok(display_set_orientation(dev, DISPLAY_ORIENTATION_NORMAL));
+}
+
+ZTEST(st7735s, test_theme_switch)
+{
+	struct st7735s_emul_stats stats;
+
+	zassert_ok(st7735s_set_inversion(dev, true));
+	zassert_ok(st7735s_set_inversion(dev, true));
+	zassert_equal(st7735s_set_gamma(dev, true), -ENOTSUP);
+
+	st7735s_emul_get_stats(emul, &stats);
+	zassert_equal(stats.cmd_bytes, 1, "one INVON, repeats are dropped");
+	zassert_equal(stats.pixel_bytes, 0);
+
+	zassert_ok(st7735s_set_inversion(dev, false));
+}
+
+ZTEST(st7735s, test_partial_idle)
+{
+	static const uint8_t expected[] = {
+		ST7735S_CMD_PTLAR, ST7735S_CMD_PTLON, ST7735S_CMD_IDMON,
+	};
+	uint8_t cmds[ST7735S_EMUL_CMD_LOG_SIZE];
+	struct st7735s_emul_modes modes;
+	struct st7735s_emul_stats stats;
+
+	zassert_equal(st7735s_set_partial_area(dev, 10, 9), -EINVAL);
+	zassert_equal(st7735s_set_partial_area(dev, 0, ST7735S_RAM_HEIGHT),
+		      -EINVAL);
+
+	zassert_ok(st7735s_set_partial_area(dev, 0, 33));
+	zassert_ok(st7735s_set_partial_mode(dev, true));
+	zassert_ok(st7735s_set_idle_mode(dev, true));
+
+	st7735s_emul_get_stats(emul, &stats);
+	zassert_equal(stats.cmd_bytes, 3, "PTLAR, PTLON and IDMON expected");
+	zassert_equal(stats.param_bytes, 4);
+	zassert_equal(st7735s_emul_get_cmd_log(emul, cmds, sizeof(cmds)),
+		      sizeof(expected));
+	zassert_mem_equal(cmds, expected, sizeof(expected));
+	st7735s_emul_get_modes(emul, &modes);
+	zassert_true(modes.partial);
+	zassert_true(modes.idle);
+
+	zassert_ok(st7735s_set_idle_mode(dev, false));
+	zassert_ok(st7735s_set_partial_mode(dev, false));
+}
+
+ZTEST(st7735s, test_stats)
+{
+	struct display_buffer_descriptor desc = {
+		.buf_size = sizeof(pixels),
+		.width = 4,
+		.height = 3,
+		.pitch = 4,
+	};
+	struct st7735s_stats stats;
+
+	Z_TEST_SKIP_IFNDEF(CONFIG_ST7735S_STATS);
+	Z_TEST_SKIP_IFDEF(CONFIG_ST7735S_PIXEL_DOUBLING);
+
+	zassert_ok(st7735s_reset_stats(dev));
+	fill_pattern(desc.width, desc.height, desc.pitch);
+	zassert_ok(display_write(dev, 0, 0, &desc, pixels));
+	zassert_ok(st7735s_get_stats(dev, &stats));
+
+	zassert_equal(stats.writes, 1);
+	zassert_equal(stats.windows, 1);
+	zassert_equal(stats.transactions, 6);
+	zassert_equal(stats.bytes, 3 + 8 + 4 * 3 * 2);
+	zassert_equal(stats.latency_min_us, stats.latency_max_us);
+}
+
+ZTEST(st7735s, test_write_interleaved)
+{
+	struct display_buffer_descriptor desc = {
+		.buf_size = sizeof(pixels),
+		.width = 16,
+		.height = 8,
+		.pitch = 16,
+	};
+	struct st7735s_write_req reqs[] = {
+		{ .dev = dev, .x = 0, .y = 0, .desc = &desc, .buf = pixels },
+		{ .dev = dev_b, .x = 5, .y = 6, .desc = &desc, .buf = pixels },
+	};
+	struct st7735s_emul_stats stats;
+
+	Z_TEST_SKIP_IFDEF(CONFIG_ST7735S_PIXEL_DOUBLING);
+
+	fill_pattern(desc.width, desc.height, desc.pitch);
+	zassert_ok(st7735s_write_interleaved(reqs, ARRAY_SIZE(reqs)));
+
+	for (uint16_t y = 0; y < desc.height; y++) {
+		for (uint16_t x = 0; x < desc.width; x++) {
+			zassert_equal(st7735s_emul_get_pixel(emul,
+					PANEL_X_OFFSET + x, PANEL_Y_OFFSET + y),
+				      (y << 8) | x, "pixel %u,%u", x, y);
+			zassert_equal(st7735s_emul_get_pixel(emul_b,
+					5 + x, 6 + y),
+				      (y << 8) | x, "pixel %u,%u", x, y);
+		}
+	}
+
+	st7735s_emul_get_stats(emul_b, &stats);
+	zassert_equal(stats.windows,
+		      DIV_ROUND_UP(desc.height, CONFIG_ST7735S_INTERLEAVE_ROWS));
+	zassert_equal(stats.pixel_bytes, 16 * 8 * 2);
+}
+
+ZTEST(st7735s, test_tile_diff)
+{
+	struct display_buffer_descriptor desc = {
+		.buf_size = sizeof(pixels),
+		.width = 16,
+		.height = 8,
+		.pitch = 16,
+	};
+	struct st7735s_emul_stats stats;
+
+	Z_TEST_SKIP_IFNDEF(CONFIG_ST7735S_TILE_DIFF);
+	Z_TEST_SKIP_IFDEF(CONFIG_ST7735S_PIXEL_DOUBLING);
+
+	fill_pattern(desc.width, desc.height, desc.pitch);
+	zassert_ok(display_write(dev, 32, 64, &desc, pixels));
+
+	/* Unchanged content, nothing to send */
+	st7735s_emul_reset_stats(emul);
+	zassert_ok(display_write(dev, 32, 64, &desc, pixels));
+	st7735s_emul_get_stats(emul, &stats);
+	zassert_equal(stats.pixel_bytes, 0);
+	zassert_equal(stats.windows, 0);
+
+	/* One pixel changed, only its tile goes out */
+	put_pixel(0xffff, &pixels[(3 * desc.pitch + 12) * 2]);
+	st7735s_emul_reset_stats(emul);
+	zassert_ok(display_write(dev, 32, 64, &desc, pixels));
+	st7735s_emul_get_stats(emul, &stats);
+	zassert_equal(stats.windows, 1);
+	zassert_equal(stats.pixels, CONFIG_ST7735S_TILE_SIZE * 8);
+	zassert_equal(st7735s_emul_get_pixel(emul, PANEL_X_OFFSET + 32 + 12,
+					     PANEL_Y_OFFSET + 64 + 3), 0xffff);
+}
+
+#if CONFIG_ST7735S_STATIC_TIMEOUT_MS > 0
+ZTEST(st7735s, test_static_timeout)
+{
+	static const uint8_t enter[] = {
+		ST7735S_CMD_PTLON, ST7735S_CMD_IDMON,
+	};
+	static const uint8_t leave[] = {
+		ST7735S_CMD_IDMOFF, ST7735S_CMD_NORON,
+		ST7735S_CMD_CASET, ST7735S_CMD_RASET, ST7735S_CMD_RAMWR,
+	};
+	struct display_buffer_descriptor desc = {
+		.buf_size = sizeof(pixels),
+		.width = 1,
+		.height = 1,
+		.pitch = 1,
+	};
+	uint8_t cmds[ST7735S_EMUL_CMD_LOG_SIZE];
+	struct st7735s_emul_modes modes;
+
+	zassert_ok(st7735s_set_partial_area(dev, 0, 33));
+	st7735s_emul_reset_stats(emul);
+
+	zassert_ok(st7735s_set_static_modes(dev, true, true));
+	k_msleep(2 * CONFIG_ST7735S_STATIC_TIMEOUT_MS);
+
+	zassert_equal(st7735s_emul_get_cmd_log(emul, cmds, sizeof(cmds)),
+		      sizeof(enter));
+	zassert_mem_equal(cmds, enter, sizeof(enter));
+	st7735s_emul_get_modes(emul, &modes);
+	zassert_true(modes.partial);
+	zassert_true(modes.idle);
+
+	/* Full scanning and colors are back before any pixel is sent */
+	st7735s_emul_reset_stats(emul);
+	put_pixel(0xffff, pixels);
+	zassert_ok(display_write(dev, 0, 0, &desc, pixels));
+
+	zassert_equal(st7735s_emul_get_cmd_log(emul, cmds, sizeof(cmds)),
+		      sizeof(leave));
+	zassert_mem_equal(cmds, leave, sizeof(leave));
+	st7735s_emul_get_modes(emul, &modes);
+	zassert_false(modes.partial);
+	zassert_false(modes.idle);
+
+	/* Let the timeout re-armed by the write pass without effect */
+	zassert_ok(st7735s_set_static_modes(dev, false, false));
+	k_msleep(2 * CONFIG_ST7735S_STATIC_TIMEOUT_MS);
+	st7735s_emul_get_modes(emul, &modes);
+	zassert_false(modes.partial);
+	zassert_false(modes.idle);
+}
+#endif /* CONFIG_ST7735S_STATIC_TIMEOUT_MS > 0 */
+
+#ifdef CONFIG_ST7735S_FRAME_SYNC
+static const struct gpio_dt_spec te =
+	GPIO_DT_SPEC_GET(DT_NODELABEL(st7735s), te_gpios);
+
+static void te_edge(struct k_timer *timer)
+{
+	ARG_UNUSED(timer);
+
+	gpio_emul_input_set(te.port, te.pin, 1);
+}
+
+K_TIMER_DEFINE(te_timer, te_edge, NULL);
+
+ZTEST(st7735s, test_frame_sync)
+{
+	struct display_buffer_descriptor desc = {
+		.buf_size = sizeof(pixels),
+		.width = 1,
+		.height = 1,
+		.pitch = 1,
+	};
+	int64_t start;
+
+	put_pixel(0x1234, pixels);
+	gpio_emul_input_set(te.port, te.pin, 0);
+	zassert_ok(st7735s_frame_done(dev));
+
+	/* The first write of a frame starts on the TE edge */
+	k_timer_start(&te_timer, K_MSEC(2), K_NO_WAIT);
+	start = k_uptime_get();
+	zassert_ok(display_write(dev, 0, 0, &desc, pixels));
+	zassert_true(k_uptime_get() - start >= 2, "write did not wait for TE");
+
+	/* The rest of the frame goes out right away, no edge is coming */
+	gpio_emul_input_set(te.port, te.pin, 0);
+	start = k_uptime_get();
+	zassert_ok(display_write(dev, 1, 0, &desc, pixels));
+	zassert_ok(display_write(dev, 2, 0, &desc, pixels));
+	zassert_true(k_uptime_get() - start < 2, "write waited within a frame");
+
+	zassert_equal(st7735s_emul_get_pixel(emul, PANEL_X_OFFSET + 2,
+					     PANEL_Y_OFFSET), 0x1234);
+}
+
+/* Frame period of the panel without TE, from its frmctr1 as the driver */
+#define FRMCTR1_B(i) DT_PROP_BY_IDX(DT_NODELABEL(st7735s_b), frmctr1, i)
+#define FRAME_B_US							\
+	((uint64_t)((FRMCTR1_B(0) & 0x0f) * 2 + 40) *			\
+	 (160 + (FRMCTR1_B(1) & 0x3f) + (FRMCTR1_B(2) & 0x3f) + 2) *	\
+	 USEC_PER_SEC / 850000)
+
+ZTEST(st7735s, test_frame_pacing)
+{
+	struct display_buffer_descriptor desc = {
+		.buf_size = sizeof(pixels),
+		.width = 1,
+		.height = 1,
+		.pitch = 1,
+	};
+	int64_t start;
+
+	put_pixel(0x4321, pixels);
+
+	/* Every write is a frame, each starts a frame period after the last */
+	zassert_ok(display_write(dev_b, 0, 0, &desc, pixels));
+	start = k_uptime_get();
+	zassert_ok(display_write(dev_b, 1, 0, &desc, pixels));
+	zassert_ok(display_write(dev_b, 2, 0, &desc, pixels));
+	zassert_true(k_uptime_get() - start >= FRAME_B_US / USEC_PER_MSEC,
+		     "writes were not paced");
+
+	/* With frames marked, only the first write of a frame waits */
+	zassert_ok(st7735s_frame_done(dev_b));
+	zassert_ok(display_write(dev_b, 3, 0, &desc, pixels));
+	start = k_uptime_get();
+	zassert_ok(display_write(dev_b, 4, 0, &desc, pixels));
+	zassert_ok(display_write(dev_b, 5, 0, &desc, pixels));
+	zassert_true(k_uptime_get() - start < FRAME_B_US / USEC_PER_MSEC,
+		     "write waited within a frame");
+
+	zassert_equal(st7735s_emul_get_pixel(emul_b, 5, 0), 0x4321);
+}
+#endif /* CONFIG_ST7735S_FRAME_SYNC */
+
+#if DT_NODE_EXISTS(DT_NODELABEL(st7735s_c))
+ZTEST(st7735s, test_rgb444)
+{
+	/* Channels at 0 or full scale survive the 12-bit round trip */
+	static const uint16_t colors[] = {
+		0xf800, 0x07e0, 0x001f, 0xffff,
+		0x0000, 0xf81f, 0xffe0, 0x07ff,
+	};
+	struct display_buffer_descriptor desc = {
+		.buf_size = sizeof(pixels),
+		.width = 4,
+		.height = 2,
+		.pitch = 4,
+	};
+	struct st7735s_emul_modes modes;
+	struct st7735s_emul_stats stats;
+
+	Z_TEST_SKIP_IFNDEF(CONFIG_ST7735S_RGB444);
+
+	st7735s_emul_get_modes(emul_c, &modes);
+	zassert_equal(modes.colmod & ST7735S_COLMOD_IFPF_MASK,
+		      ST7735S_COLMOD_12BIT);
+
+	for (size_t i = 0; i < ARRAY_SIZE(colors); i++) {
+		put_pixel(colors[i], &pixels[i * 2]);
+	}
+	zassert_ok(display_write(dev_c, 3, 5, &desc, pixels));
+
+	for (uint16_t y = 0; y < desc.height; y++) {
+		for (uint16_t x = 0; x < desc.width; x++) {
+			zassert_equal(st7735s_emul_get_pixel(emul_c, 3 + x,
+							     5 + y),
+				      colors[y * desc.width + x],
+				      "pixel %u,%u", x, y);
+		}
+	}
+
+	/* Three bytes per pixel pair */
+	st7735s_emul_get_stats(emul_c, &stats);
+	zassert_equal(stats.pixels, 8);
+	zassert_equal(stats.pixel_bytes, 8 * 3 / 2);
+}
+#endif
+
+#if DT_NODE_HAS_PROP(DT_NODELABEL(st7735s), mirror_displays)
+ZTEST(st7735s, test_mirror_displays)
+{
+	static const uint8_t expected[] = {
+		ST7735S_CMD_DISP_OFF, ST7735S_CMD_DISP_ON,
+	};
+	struct display_buffer_descriptor desc = {
+		.buf_size = sizeof(pixels),
+		.width = 16,
+		.height = 8,
+		.pitch = 16,
+	};
+	uint8_t cmds[ST7735S_EMUL_CMD_LOG_SIZE];
+	struct st7735s_emul_modes modes;
+
+	Z_TEST_SKIP_IFDEF(CONFIG_ST7735S_PIXEL_DOUBLING);
+
+	/* One write lands in both panels, each at its own offsets */
+	fill_pattern(desc.width, desc.height, desc.pitch);
+	zassert_ok(display_write(dev, 30, 40, &desc, pixels));
+
+	for (uint16_t y = 0; y < desc.height; y++) {
+		for (uint16_t x = 0; x < desc.width; x++) {
+			zassert_equal(st7735s_emul_get_pixel(emul,
+					PANEL_X_OFFSET + 30 + x,
+					PANEL_Y_OFFSET + 40 + y),
+				      (y << 8) | x, "pixel %u,%u", x, y);
+			zassert_equal(st7735s_emul_get_pixel(emul_b,
+					30 + x, 40 + y),
+				      (y << 8) | x, "pixel %u,%u", x, y);
+		}
+	}
+
+	st7735s_emul_reset_stats(emul_b);
+	zassert_ok(display_blanking_on(dev));
+	zassert_ok(display_blanking_off(dev));
+	zassert_equal(st7735s_emul_get_cmd_log(emul_b, cmds, sizeof(cmds)),
+		      sizeof(expected));
+	zassert_mem_equal(cmds, expected, sizeof(expected));
+
+	zassert_ok(st7735s_set_inversion(dev, true));
+	st7735s_emul_get_modes(emul_b, &modes);
+	zassert_true(modes.inverted);
+
+	zassert_ok(st7735s_set_inversion(dev, false));
+	st7735s_emul_get_modes(emul_b, &modes);
+	zassert_false(modes.inverted);
+}
+#endif
+
+ZTEST(st7735s, test_pixel_doubling)
+{
+	struct display_buffer_descriptor desc = {
+		.buf_size = sizeof(pixels),
+		.width = 4,
+		.height = 3,
+		.pitch = 16,
+	};
+	struct display_capabilities caps;
+	struct st7735s_emul_stats stats;
+
+	Z_TEST_SKIP_IFNDEF(CONFIG_ST7735S_PIXEL_DOUBLING);
+
+	display_get_capabilities(dev, &caps);
+	zassert_equal(caps.x_resolution, 64);
+	zassert_equal(caps.y_resolution, 64);
+
+	fill_pattern(desc.width, desc.height, desc.pitch);
+	zassert_ok(display_write(dev, 10, 20, &desc, pixels));
+
+	/* Every pixel covers a 2x2 block at twice the position */
+	for (uint16_t y = 0; y < 2 * desc.height; y++) {
+		for (uint16_t x = 0; x < 2 * desc.width; x++) {
+			zassert_equal(st7735s_emul_get_pixel(emul,
+					PANEL_X_OFFSET + 20 + x,
+					PANEL_Y_OFFSET + 40 + y),
+				      ((y / 2) << 8) | (x / 2),
+				      "pixel %u,%u", x, y);
+		}
+	}
+
+	st7735s_emul_get_stats(emul, &stats);
+	zassert_equal(stats.windows, 1);
+	zassert_equal(stats.cmd_bytes, 3, "CASET, RASET and RAMWR expected");
+	zassert_equal(stats.pixels, 4 * 4 * 3);
+	zassert_equal(stats.pixel_bytes, 4 * 4 * 3 * 2);
+}
+
+#ifdef CONFIG_ST7735S_BOOT_SPLASH
+ZTEST(st7735s, test_boot_splash)
+{
+	const struct st7735s_splash *splash = st7735s_boot_splash(dev);
+	uint16_t x0 = PANEL_X_OFFSET + (128 - splash->width) / 2;
+	uint16_t y0 = PANEL_Y_OFFSET + (128 - splash->height) / 2;
+
+	/* Streamed at init, first run at the top left of the image */
+	zassert_equal(st7735s_emul_get_pixel(emul, x0, y0),
+		      sys_get_be16(&splash->rle[1]));
+	zassert_equal(st7735s_emul_get_pixel(emul, x0 - 1, y0), splash->bg);
+	zassert_equal(st7735s_emul_get_pixel(emul_b, (128 - splash->width) / 2,
+					     (128 - splash->height) / 2),
+		      sys_get_be16(&splash->rle[1]));
+}
+#endif /* CONFIG_ST7735S_BOOT_SPLASH */
+
+static void st7735s_before(void *fixture)
+{
+	ARG_UNUSED(fixture);
+
+	st7735s_emul_reset_stats(emul);
+	st7735s_emul_reset_stats(emul_b);
+#if DT_NODE_EXISTS(DT_NODELABEL(st7735s_c))
+	st7735s_emul_reset_stats(emul_c);
+#endif
+}
+
+ZTEST_SUITE(st7735s, NULL, NULL, st7735s_before, NULL, NULL);
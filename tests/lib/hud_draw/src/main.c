@@ -0,0 +1,375 @@
+/*
+ * Copyright (c) 2024 kristosb
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/*
+ * @file test hud_draw library
+ *
+ * This suite checks the span fill around alignment, the horizon fill
+ * against a per pixel evaluation of the same split and the run merged
+ * lines against a pixel by pixel Bresenham.
+ */
+
+#include <string.h>
+
+#include <zephyr/ztest.h>
+#include <zephyr/kernel.h>
+
+#include <app/lib/hud_draw.h>
+
+#define SKY 0x001f
+#define GROUND 0xa145
+#define GUARD 0xdead
+
+#define W 40
+#define H 40
+
+/* One guard pixel on each side of every row */
+#define STRIDE (W + 2)
+
+static uint16_t buf[H * STRIDE] __aligned(4);
+static uint16_t ref[H * STRIDE];
+static uint8_t bits[H * ((W + 7) / 8)];
+
+#define LINE 0x07e0
+
+/* sin and cos * 32767, every 15 degrees from -180 to 180 */
+static const int32_t rolls[][2] = {
+	{ 0, -32767 },
+	{ -8481, -31650 },
+	{ -16383, -28377 },
+	{ -23170, -23170 },
+	{ -28377, -16383 },
+	{ -31650, -8481 },
+	{ -32767, 0 },
+	{ -31650, 8481 },
+	{ -28377, 16384 },
+	{ -23170, 23170 },
+	{ -16383, 28377 },
+	{ -8481, 31650 },
+	{ 0, 32767 },
+	{ 8481, 31650 },
+	{ 16383, 28377 },
+	{ 23170, 23170 },
+	{ 28377, 16384 },
+	{ 31650, 8481 },
+	{ 32767, 0 },
+	{ 31650, -8481 },
+	{ 28377, -16383 },
+	{ 23170, -23170 },
+	{ 16383, -28377 },
+	{ 8481, -31650 },
+	{ 0, -32767 },
+};
+
+static bool is_ground(int x, int y, const struct hud_horizon *hz)
+{
+	int64_t dx = x - hz->cx;
+	int64_t dy = y - hz->cy;
+
+	return -dx * hz->sin + dy * hz->cos > ((int64_t)hz->offset << 15);
+}
+
+static void check_horizon(int x0, int y0, const struct hud_horizon *hz)
+{
+	for (size_t i = 0; i < ARRAY_SIZE(buf); i++) {
+		buf[i] = GUARD;
+	}
+
+	hud_draw_horizon(&buf[1], STRIDE, x0, y0, W, H, hz);
+
+	for (int y = 0; y < H; y++) {
+		zassert_equal(buf[y * STRIDE], GUARD, "row %d", y);
+		zassert_equal(buf[y * STRIDE + W + 1], GUARD, "row %d", y);
+
+		for (int x = 0; x < W; x++) {
+			uint16_t expected = is_ground(x0 + x, y0 + y, hz) ?
+					    GROUND : SKY;
+
+			zassert_equal(buf[y * STRIDE + 1 + x], expected,
+				      "pixel %d,%d sin %d cos %d offset %d", x, y,
+				      hz->sin, hz->cos, hz->offset);
+		}
+	}
+}
+
+ZTEST(hud_draw, test_fill16_alignment)
+{
+	for (size_t start = 0; start < 4; start++) {
+		for (size_t count = 0; count < 20; count++) {
+			for (size_t i = 0; i < 32; i++) {
+				buf[i] = GUARD;
+			}
+
+			hud_draw_fill16(&buf[start], count, SKY);
+
+			for (size_t i = 0; i < 32; i++) {
+				bool in = i >= start && i < start + count;
+
+				zassert_equal(buf[i], in ? SKY : GUARD,
+					      "start %u count %u pixel %u",
+					      (unsigned int)start, (unsigned int)count,
+					      (unsigned int)i);
+			}
+		}
+	}
+}
+
+ZTEST(hud_draw, test_level)
+{
+	struct hud_horizon hz = {
+		.cx = 20, .cy = 20, .offset = 5,
+		.sin = 0, .cos = 32767,
+		.sky = SKY, .ground = GROUND,
+	};
+
+	check_horizon(0, 0, &hz);
+	zassert_equal(buf[25 * STRIDE + 1], SKY, "the edge row is sky");
+	zassert_equal(buf[26 * STRIDE + 1], GROUND);
+
+	/* Upside down */
+	hz.cos = -32767;
+	check_horizon(0, 0, &hz);
+}
+
+ZTEST(hud_draw, test_rolled)
+{
+	struct hud_horizon hz = {
+		.cx = 70, .cy = 30, .sky = SKY, .ground = GROUND,
+	};
+	const int offsets[] = { -30, -7, 0, 5, 22 };
+
+	/* Area at (50, 10), the center in its middle */
+	for (size_t r = 0; r < ARRAY_SIZE(rolls); r++) {
+		hz.sin = rolls[r][0];
+		hz.cos = rolls[r][1];
+
+		for (size_t i = 0; i < ARRAY_SIZE(offsets); i++) {
+			hz.offset = offsets[i];
+			check_horizon(50, 10, &hz);
+		}
+	}
+}
+
+ZTEST(hud_draw, test_edge_off_area)
+{
+	/* Steep edge far to the side, the rows are all sky or all ground */
+	struct hud_horizon hz = {
+		.cx = 500, .cy = 20, .offset = 0,
+		.sin = 32767, .cos = 100,
+		.sky = SKY, .ground = GROUND,
+	};
+
+	check_horizon(0, 0, &hz);
+	zassert_equal(buf[1], GROUND);
+
+	hz.sin = 1;
+	check_horizon(0, 0, &hz);
+}
+
+ZTEST(hud_draw, test_horizon_speed)
+{
+	struct hud_horizon hz = {
+		.cx = 20, .cy = 20, .offset = 3,
+		.sin = 11207, .cos = 30792,
+		.sky = SKY, .ground = GROUND,
+	};
+	uint32_t start = k_cycle_get_32();
+
+	for (int i = 0; i < 100; i++) {
+		hud_draw_horizon(&buf[1], STRIDE, 0, 0, W, H, &hz);
+	}
+
+	TC_PRINT("horizon %ux%u: %u cycles\n", W, H,
+		 (k_cycle_get_32() - start) / 100);
+}
+
+static void ref_put(int x, int y, int x0, int y0)
+{
+	x -= x0;
+	y -= y0;
+
+	if (x >= 0 && x < W && y >= 0 && y < H) {
+		ref[y * STRIDE + 1 + x] = LINE;
+	}
+}
+
+/* One pixel at a time, thickness across the major axis */
+static void ref_line(int x1, int y1, int x2, int y2, int width, int x0, int y0)
+{
+	int half0 = (width - 1) / 2;
+	int half1 = width - 1 - half0;
+	int dx = x2 > x1 ? x2 - x1 : x1 - x2;
+	int dy = y2 > y1 ? y1 - y2 : y2 - y1;
+	int sx = x1 < x2 ? 1 : -1;
+	int sy = y1 < y2 ? 1 : -1;
+	int err = dx + dy;
+
+	for (int x = x1, y = y1;;) {
+		int e2 = 2 * err;
+
+		for (int t = -half1; t <= half0; t++) {
+			if (-dy > dx) {
+				ref_put(x + t, y, x0, y0);
+			} else {
+				ref_put(x, y + t, x0, y0);
+			}
+		}
+		if (x == x2 && y == y2) {
+			break;
+		}
+		if (e2 >= dy) {
+			err += dy;
+			x += sx;
+		}
+		if (e2 <= dx) {
+			err += dx;
+			y += sy;
+		}
+	}
+}
+
+static void check_line(int x1, int y1, int x2, int y2, int width, int x0,
+		       int y0)
+{
+	struct hud_draw_buf dst = {
+		.buf = &buf[1], .stride = STRIDE, .x0 = x0, .y0 = y0,
+		.width = W, .height = H, .format = HUD_DRAW_RGB565,
+	};
+	struct hud_draw_buf a1 = {
+		.buf = bits, .stride = W, .x0 = x0, .y0 = y0,
+		.width = W, .height = H, .format = HUD_DRAW_A1,
+	};
+
+	for (size_t i = 0; i < ARRAY_SIZE(buf); i++) {
+		buf[i] = GUARD;
+		ref[i] = GUARD;
+	}
+	memset(bits, 0, sizeof(bits));
+
+	ref_line(x1, y1, x2, y2, width, x0, y0);
+	hud_draw_line(&dst, x1, y1, x2, y2, width, LINE);
+	hud_draw_line(&a1, x1, y1, x2, y2, width, LINE);
+
+	for (int y = 0; y < H; y++) {
+		/* Guard pixels included */
+		for (int x = -1; x <= W; x++) {
+			zassert_equal(buf[y * STRIDE + 1 + x],
+				      ref[y * STRIDE + 1 + x],
+				      "pixel %d,%d of (%d,%d)-(%d,%d) w %d", x, y,
+				      x1, y1, x2, y2, width);
+		}
+
+		for (int x = 0; x < W; x++) {
+			bool set = bits[y * ((W + 7) / 8) + x / 8] & BIT(7 - x % 8);
+
+			zassert_equal(set, ref[y * STRIDE + 1 + x] == LINE,
+				      "bit %d,%d", x, y);
+		}
+	}
+}
+
+ZTEST(hud_draw, test_line_axis)
+{
+	struct hud_draw_buf dst = {
+		.buf = &buf[1], .stride = STRIDE, .width = W, .height = H,
+		.format = HUD_DRAW_RGB565,
+	};
+
+	for (size_t i = 0; i < ARRAY_SIZE(buf); i++) {
+		buf[i] = GUARD;
+	}
+
+	/* As lv_draw_line(): end point excluded, odd extra pixel above */
+	hud_draw_line(&dst, 5, 10, 15, 10, 2, LINE);
+	hud_draw_line(&dst, 30, 20, 30, 5, 3, LINE);
+
+	for (int y = 0; y < H; y++) {
+		for (int x = 0; x < W; x++) {
+			bool h = x >= 5 && x <= 14 && y >= 9 && y <= 10;
+			bool v = x >= 29 && x <= 31 && y >= 5 && y <= 19;
+
+			zassert_equal(buf[y * STRIDE + 1 + x],
+				      (h || v) ? LINE : GUARD, "pixel %d,%d", x, y);
+		}
+	}
+}
+
+ZTEST(hud_draw, test_line_bresenham)
+{
+	const int8_t ends[][2] = {
+		{ 3, 4 }, { 36, 9 }, { 35, 33 }, { 20, 38 }, { 1, 30 },
+		{ 19, 20 }, { 21, 2 }, { 37, 21 },
+	};
+
+	for (size_t a = 0; a < ARRAY_SIZE(ends); a++) {
+		for (size_t b = 0; b < ARRAY_SIZE(ends); b++) {
+			if (a == b) {
+				continue;
+			}
+			for (int w = 1; w <= 4; w++) {
+				check_line(ends[a][0], ends[a][1], ends[b][0],
+					   ends[b][1], w, 0, 0);
+			}
+		}
+	}
+}
+
+ZTEST(hud_draw, test_line_clip)
+{
+	/* Ends outside of the area at (100, 50) */
+	check_line(80, 40, 150, 95, 3, 100, 50);
+	check_line(139, 45, 95, 91, 2, 100, 50);
+	check_line(90, 60, 160, 61, 1, 100, 50);
+	check_line(130, 0, 131, 200, 4, 100, 50);
+}
+
+ZTEST(hud_draw, test_vlines)
+{
+	const int16_t xs[] = { -1, 0, 7, 20, 21, 39, 40, 100 };
+	struct hud_draw_buf dst = {
+		.buf = &buf[1], .stride = STRIDE, .x0 = 0, .y0 = 0,
+		.width = W, .height = H, .format = HUD_DRAW_RGB565,
+	};
+	struct hud_draw_buf each = dst;
+
+	each.buf = &ref[1];
+
+	for (int w = 1; w <= 3; w++) {
+		for (size_t i = 0; i < ARRAY_SIZE(buf); i++) {
+			buf[i] = GUARD;
+			ref[i] = GUARD;
+		}
+
+		/* Rows partly above the area */
+		hud_draw_vlines(&dst, xs, ARRAY_SIZE(xs), -3, 12, w, LINE);
+		for (size_t i = 0; i < ARRAY_SIZE(xs); i++) {
+			hud_draw_line(&each, xs[i], -3, xs[i], 13, w, LINE);
+		}
+
+		for (size_t i = 0; i < ARRAY_SIZE(buf); i++) {
+			zassert_equal(buf[i], ref[i], "pixel %u width %d",
+				      (unsigned int)i, w);
+		}
+	}
+}
+
+ZTEST(hud_draw, test_line_speed)
+{
+	struct hud_draw_buf dst = {
+		.buf = &buf[1], .stride = STRIDE, .width = W, .height = H,
+		.format = HUD_DRAW_RGB565,
+	};
+	uint32_t start = k_cycle_get_32();
+
+	for (int i = 0; i < 100; i++) {
+		hud_draw_line(&dst, 2, 30, 37, 17, 2, LINE);
+	}
+
+	TC_PRINT("line 35x13 w 2: %u cycles\n",
+		 (k_cycle_get_32() - start) / 100);
+}
+
+ZTEST_SUITE(hud_draw, NULL, NULL, NULL, NULL, NULL);
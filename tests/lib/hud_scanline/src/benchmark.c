@@ -0,0 +1,498 @@
+/*
+ * Copyright (c) 2024 kristosb
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/*
+ * @file benchmark hud_scanline against the LVGL widgets
+ *
+ * Renders a compass and pitch ladder scene through the scanline renderer
+ * and through lv_compass / lv_pitch_ladder, and prints frame time and RAM
+ * for both, and times lv_draw_line() against hud_draw_lv_line() on the same
+ * strokes. The scanline scene takes its geometry from the widget constants
+ * but is not pixel identical, test_scanline_frames prints what it leaves
+ * out next to its numbers. Numbers are only meaningful on target hardware,
+ * on native_sim the suite just checks that both paths put pixels on the
+ * panel.
+ */
+
+#include <math.h>
+#include <stdio.h>
+#include <string.h>
+
+#include <zephyr/ztest.h>
+#include <zephyr/device.h>
+#include <zephyr/drivers/emul.h>
+#include <zephyr/kernel.h>
+#include <lvgl.h>
+
+#include <app/drivers/display/display_st7735s.h>
+#include <app/drivers/display/emul_st7735s.h>
+#include <app/lib/hud_draw_lv.h>
+#include <app/lib/hud_scanline.h>
+#include <app/lib/lv_compass.h>
+#include <app/lib/lv_pitch_ladder.h>
+#ifdef CONFIG_LV_HUD
+#include <app/lib/lv_hud.h>
+#endif
+
+#define BENCH_FRAMES 20
+
+/* Compass tape geometry as lv_compass draws it */
+#define COMPASS_TICKS (LV_COMPASS_TICK_RANGE + 2)
+#define COMPASS_MAJOR_Y0 COMPAS_FONT_HEIGHT
+#define COMPASS_MAJOR_Y1 (COMPAS_FONT_HEIGHT + COMPAS_MAJOR_TICK_LENGHT - 1)
+#define COMPASS_MINOR_Y1 (COMPAS_FONT_HEIGHT + COMPAS_MINOR_TICK_LENGHT - 1)
+
+/* Pitch ladder geometry as lv_pitch_ladder draws it, around its pivot */
+#define LADDER_RUNGS 5
+#define LADDER_HALF_W ((int)LV_PITCH_LADDE_CANVAS_WIDTH / 2)
+#define LADDER_GAP ((int)(LV_PITCH_LADDER_HORIZ_GAP) / 2)
+#define LADDER_CY (64 + (int)LV_PITCH_LADDER_CANVAS_Y_OFFSET)
+#define LADDER_SCALE ((int)LV_PITCH_LADDER_PITCH_SCALE)
+#define LADDER_AIM ((int)LV_PITCH_LADDER_AIM_W / 2)
+
+/* 5x7 glyphs scaled up to the widgets' font height */
+#define LABEL_SCALE (COMPAS_FONT_HEIGHT / 7)
+
+#define MAX_PRIMS (3 * COMPASS_TICKS + 3 * LADDER_RUNGS + 2)
+
+/* Strip the line paths are timed in, and how often the strokes repeat */
+#define LINE_W 128
+#define LINE_H 32
+#define LINE_REPEAT 50
+
+static const struct device *const display =
+	DEVICE_DT_GET(DT_CHOSEN(zephyr_display));
+static const struct emul *const emul = EMUL_DT_GET(DT_CHOSEN(zephyr_display));
+
+HUD_SL_BAND_DEFINE(bench_band, 128);
+static struct hud_sl_ctx bench_ctx;
+
+static struct hud_sl_prim prims[MAX_PRIMS];
+static char labels[MAX_PRIMS][5];
+
+static size_t bench_compass(size_t n, int heading, uint16_t color)
+{
+	int first = heading / LV_COMPASS_SCALE - COMPASS_TICKS / 2;
+
+	for (int t = first; t < first + COMPASS_TICKS; t++) {
+		int deg = ((t * LV_COMPASS_SCALE) % 360 + 360) % 360;
+		int x = COMPAS_WIDTH / 2 + ((t * LV_COMPASS_SCALE - heading) *
+					    LV_COMPASS_SPACE) / LV_COMPASS_SCALE;
+
+		prims[n++] = (struct hud_sl_prim)HUD_SL_LINE(x, COMPASS_MAJOR_Y0,
+							    x, COMPASS_MAJOR_Y1,
+							    1, color);
+		prims[n++] = (struct hud_sl_prim)HUD_SL_LINE(
+			x + COMPAS_TICK_SPACING / 2, COMPASS_MAJOR_Y0,
+			x + COMPAS_TICK_SPACING / 2, COMPASS_MINOR_Y1, 1, color);
+
+		snprintf(labels[n], sizeof(labels[n]), "%d", deg / 10);
+		prims[n] = (struct hud_sl_prim)HUD_SL_TEXT(x - 6 * LABEL_SCALE, 0,
+							  LABEL_SCALE, color,
+							  labels[n]);
+		n++;
+	}
+
+	return n;
+}
+
+static size_t bench_ladder(size_t n, int pitch, int roll, uint16_t color)
+{
+	float s = sinf(roll * 3.14159265f / 180.0f);
+	float c = cosf(roll * 3.14159265f / 180.0f);
+	int cx = 64;
+	int cy = LADDER_CY;
+
+	for (int r = -LADDER_RUNGS / 2; r <= LADDER_RUNGS / 2; r++) {
+		int rung = (pitch / LADDER_SCALE + r) * LADDER_SCALE;
+		float dy = (float)(pitch - rung) * LV_PITCH_LADDER_SPACE /
+			   LADDER_SCALE;
+		/* Rotate the two half rungs around the boresight */
+		int x0 = cx + (int)(-LADDER_HALF_W * c - dy * s);
+		int y0 = cy + (int)(-LADDER_HALF_W * s + dy * c);
+		int x1 = cx + (int)(-LADDER_GAP * c - dy * s);
+		int y1 = cy + (int)(-LADDER_GAP * s + dy * c);
+		int x2 = cx + (int)(LADDER_GAP * c - dy * s);
+		int y2 = cy + (int)(LADDER_GAP * s + dy * c);
+		int x3 = cx + (int)(LADDER_HALF_W * c - dy * s);
+		int y3 = cy + (int)(LADDER_HALF_W * s + dy * c);
+
+		prims[n++] = (struct hud_sl_prim)HUD_SL_LINE(x0, y0, x1, y1, 2,
+							    color);
+		prims[n++] = (struct hud_sl_prim)HUD_SL_LINE(x2, y2, x3, y3, 2,
+							    color);
+
+		snprintf(labels[n], sizeof(labels[n]), "%d", rung);
+		prims[n] = (struct hud_sl_prim)HUD_SL_TEXT(x3 + 3, y3 - 7,
+							  LABEL_SCALE, color,
+							  labels[n]);
+		n++;
+	}
+
+	/* Boresight */
+	prims[n++] = (struct hud_sl_prim)HUD_SL_LINE(cx - LADDER_AIM, cy,
+						    cx + LADDER_AIM, cy, 1,
+						    color);
+	prims[n++] = (struct hud_sl_prim)HUD_SL_LINE(cx, cy - LADDER_AIM,
+						    cx, cy + LADDER_AIM, 1,
+						    color);
+
+	return n;
+}
+
+static uint32_t cyc_to_us(uint32_t cycles)
+{
+	return k_cyc_to_us_ceil32(cycles);
+}
+
+typedef void (*bench_line_fn)(lv_draw_ctx_t *draw_ctx,
+			      const lv_draw_line_dsc_t *dsc,
+			      const lv_point_t *point1,
+			      const lv_point_t *point2);
+
+static lv_color_t line_buf[LINE_W * LINE_H];
+
+/* HUD strokes: a level rung, a tick, rungs rolled by 7 and 23 degrees */
+static const lv_point_t line_points[][2] = {
+	{ { 4, 16 }, { 123, 16 } },
+	{ { 64, 2 }, { 64, 29 } },
+	{ { 10, 22 }, { 117, 9 } },
+	{ { 30, 30 }, { 97, 2 } },
+};
+
+static uint32_t bench_lines(lv_draw_ctx_t *draw_ctx, bench_line_fn draw,
+			    const lv_draw_line_dsc_t *dsc)
+{
+	uint32_t start;
+	size_t lit = 0;
+
+	memset(line_buf, 0, sizeof(line_buf));
+	start = k_cycle_get_32();
+
+	for (int r = 0; r < LINE_REPEAT; r++) {
+		for (size_t i = 0; i < ARRAY_SIZE(line_points); i++) {
+			draw(draw_ctx, dsc, &line_points[i][0],
+			     &line_points[i][1]);
+		}
+	}
+
+	start = k_cycle_get_32() - start;
+
+	for (size_t i = 0; i < ARRAY_SIZE(line_buf); i++) {
+		lit += line_buf[i].full != 0;
+	}
+	zassert_true(lit > 0);
+
+	return start;
+}
+
+ZTEST(hud_scanline_bench, test_scanline_frames)
+{
+	uint16_t color = hud_sl_color(0x00, 0xff, 0x00);
+	struct st7735s_emul_stats stats;
+	uint32_t start;
+	uint32_t cycles;
+	size_t n = 0;
+
+	st7735s_emul_reset_stats(emul);
+	start = k_cycle_get_32();
+
+	for (int f = 0; f < BENCH_FRAMES; f++) {
+		n = bench_compass(0, f * 7, color);
+		n = bench_ladder(n, f - BENCH_FRAMES / 2, f * 3 - 30, color);
+		zassert_true(n <= ARRAY_SIZE(prims));
+		zassert_ok(hud_sl_render(&bench_ctx, prims, n));
+	}
+
+	cycles = k_cycle_get_32() - start;
+	st7735s_emul_get_stats(emul, &stats);
+
+	TC_PRINT("scanline: %u primitives, %u us/frame, %u bytes/frame\n",
+		 (unsigned int)n, cyc_to_us(cycles) / BENCH_FRAMES,
+		 stats.pixel_bytes / BENCH_FRAMES);
+	TC_PRINT("scanline: RAM %u bytes bands + %u bytes scene\n",
+		 (unsigned int)sizeof(bench_band),
+		 (unsigned int)(sizeof(prims) + sizeof(labels)));
+	TC_PRINT("scanline: no sky/ground fill, no anti-aliasing, "
+		 "5x7 glyphs x%d, no heading readout\n", LABEL_SCALE);
+
+	zassert_equal(stats.pixels, BENCH_FRAMES * 128 * 128);
+}
+
+ZTEST(hud_scanline_bench, test_lvgl_frames)
+{
+	struct st7735s_emul_stats stats;
+	lv_obj_t *compass;
+	lv_obj_t *ladder;
+	uint32_t start;
+	uint32_t cycles;
+	size_t lvgl_ram;
+
+	compass = lv_compass_create(lv_scr_act());
+	ladder = lv_pitch_ladder_create(lv_scr_act());
+	zassert_not_null(compass);
+	zassert_not_null(ladder);
+	lv_refr_now(NULL);
+
+	st7735s_emul_reset_stats(emul);
+	start = k_cycle_get_32();
+
+	for (int f = 0; f < BENCH_FRAMES; f++) {
+		lv_compass_angle(compass, f * 7);
+		lv_pitch_ladder_set_angles(ladder, f - BENCH_FRAMES / 2,
+					   (f * 3 - 30) * 10);
+		/* Runs the deferred ladder update */
+		lv_timer_handler();
+		lv_obj_invalidate(lv_scr_act());
+		lv_refr_now(NULL);
+	}
+
+	cycles = k_cycle_get_32() - start;
+	st7735s_emul_get_stats(emul, &stats);
+
+	/* The ladder canvas is allocated from the pool */
+	lvgl_ram = CONFIG_LV_Z_MEM_POOL_SIZE;
+#ifdef CONFIG_LV_Z_VDB_SIZE
+	lvgl_ram += 128 * 128 * sizeof(lv_color_t) * CONFIG_LV_Z_VDB_SIZE / 100;
+#endif
+#ifdef CONFIG_LV_PITCH_LADDER_STRIP
+	lvgl_ram += DIV_ROUND_UP(LV_PITCH_LADDE_CANVAS_WIDTH, 8) *
+		    (18 * LV_PITCH_LADDER_SPACE + LV_PITCH_LADDE_CANVAS_HEIGHT);
+#endif
+#ifdef CONFIG_LV_COMPASS_TAPE_CACHE
+	lvgl_ram += (360 / LV_COMPASS_SCALE * LV_COMPASS_SPACE / 8) *
+		    (COMPAS_FONT_HEIGHT + COMPAS_MAJOR_TICK_LENGHT);
+#endif
+
+	TC_PRINT("lvgl: %u us/frame, %u bytes/frame\n",
+		 cyc_to_us(cycles) / BENCH_FRAMES,
+		 stats.pixel_bytes / BENCH_FRAMES);
+	TC_PRINT("lvgl: RAM %u bytes pool + draw buffer + strips\n",
+		 (unsigned int)lvgl_ram);
+
+	zassert_true(stats.pixels > 0);
+
+	lv_obj_del(ladder);
+	lv_obj_del(compass);
+}
+
+#ifdef CONFIG_LV_HUD
+ZTEST(hud_scanline_bench, test_hud_frames)
+{
+	struct st7735s_emul_stats stats;
+	lv_obj_t *hud;
+	uint32_t start;
+	uint32_t cycles;
+
+	hud = lv_hud_create(lv_scr_act());
+	zassert_not_null(hud);
+	zassert_true(lv_obj_has_flag(lv_hud_get_compass(hud), LV_OBJ_FLAG_HIDDEN));
+	lv_refr_now(NULL);
+
+	/* Same scene as test_lvgl_frames, only what changed is invalidated */
+	st7735s_emul_reset_stats(emul);
+	start = k_cycle_get_32();
+
+	for (int f = 0; f < BENCH_FRAMES; f++) {
+		lv_hud_set_attitude(hud, f * 7, f - BENCH_FRAMES / 2,
+				    (f * 3 - 30) * 10);
+		lv_refr_now(NULL);
+	}
+
+	cycles = k_cycle_get_32() - start;
+	st7735s_emul_get_stats(emul, &stats);
+
+	TC_PRINT("lv_hud: %u us/frame, %u bytes/frame\n",
+		 cyc_to_us(cycles) / BENCH_FRAMES,
+		 stats.pixel_bytes / BENCH_FRAMES);
+
+	zassert_true(stats.pixels > 0);
+	zassert_true(stats.pixels <= BENCH_FRAMES * 128 * 128);
+
+	/* Nothing changed, nothing to flush */
+	st7735s_emul_reset_stats(emul);
+	lv_hud_set_attitude(hud, (BENCH_FRAMES - 1) * 7, BENCH_FRAMES / 2 - 1,
+			    (BENCH_FRAMES * 3 - 33) * 10);
+	lv_refr_now(NULL);
+	st7735s_emul_get_stats(emul, &stats);
+	zassert_equal(stats.pixels, 0);
+
+	/* Heading only, the compass' own regions and not the ladder */
+	st7735s_emul_reset_stats(emul);
+	lv_hud_set_attitude(hud, (BENCH_FRAMES - 1) * 7 + 1, BENCH_FRAMES / 2 - 1,
+			    (BENCH_FRAMES * 3 - 33) * 10);
+	lv_refr_now(NULL);
+	st7735s_emul_get_stats(emul, &stats);
+	zassert_true(stats.pixels > 0);
+	zassert_true(stats.pixels <= COMPAS_WIDTH * COMPAS_HEIGHT);
+
+	lv_obj_del(hud);
+	lv_refr_now(NULL);
+}
+#endif /* CONFIG_LV_HUD */
+
+ZTEST(hud_scanline_bench, test_compass_sweep)
+{
+	lv_obj_t *compass;
+	uint32_t start;
+	uint32_t cycles;
+	int frames = 0;
+
+	compass = lv_compass_create(lv_scr_act());
+	zassert_not_null(compass);
+	lv_refr_now(NULL);
+
+	/* Same sweep with and without CONFIG_LV_COMPASS_BATCH_TICKS */
+	start = k_cycle_get_32();
+	for (int heading = 0; heading < 360; heading += 7) {
+		lv_compass_angle(compass, heading);
+		lv_obj_invalidate(compass);
+		lv_refr_now(NULL);
+		frames++;
+	}
+	cycles = k_cycle_get_32() - start;
+
+	TC_PRINT("compass: %u us/frame, ticks %s\n",
+		 cyc_to_us(cycles) / frames,
+		 IS_ENABLED(CONFIG_LV_COMPASS_BATCH_TICKS) ? "batched" :
+							     "lv_draw_line");
+
+	lv_obj_del(compass);
+	lv_refr_now(NULL);
+}
+
+ZTEST(hud_scanline_bench, test_compass_invalidation)
+{
+	const uint32_t tape = COMPAS_WIDTH *
+			      (COMPAS_FONT_HEIGHT + COMPAS_MAJOR_TICK_LENGHT);
+	const uint32_t readout = 31 * (COMPAS_HEIGHT - COMPAS_FONT_HEIGHT -
+				       COMPAS_MAJOR_TICK_LENGHT);
+	struct st7735s_emul_stats stats;
+	lv_obj_t *compass;
+
+	compass = lv_compass_create(lv_scr_act());
+	zassert_not_null(compass);
+	lv_compass_angle(compass, 100);
+	lv_refr_now(NULL);
+
+	/* Tape and readout, the center mark stays */
+	st7735s_emul_reset_stats(emul);
+	lv_compass_angle(compass, 101);
+	lv_refr_now(NULL);
+	st7735s_emul_get_stats(emul, &stats);
+	TC_PRINT("compass: %u of %u pixels flushed for 1 degree\n",
+		 stats.pixels, COMPAS_WIDTH * COMPAS_HEIGHT);
+	zassert_true(stats.pixels <= tape + readout);
+
+	/* Full turn, same tape, only the readout */
+	st7735s_emul_reset_stats(emul);
+	lv_compass_angle(compass, 101 + 360);
+	lv_refr_now(NULL);
+	st7735s_emul_get_stats(emul, &stats);
+	zassert_true(stats.pixels <= readout);
+
+	lv_obj_del(compass);
+	lv_refr_now(NULL);
+}
+
+ZTEST(hud_scanline_bench, test_line_paths)
+{
+	lv_disp_t *disp = lv_disp_get_default();
+	lv_draw_ctx_t *draw_ctx = disp->driver->draw_ctx;
+	lv_disp_t *refreshing = _lv_refr_get_disp_refreshing();
+	void *buf = draw_ctx->buf;
+	lv_area_t *buf_area = draw_ctx->buf_area;
+	const lv_area_t *clip_area = draw_ctx->clip_area;
+	lv_area_t area = { 0, 0, LINE_W - 1, LINE_H - 1 };
+	lv_draw_line_dsc_t dsc;
+	uint32_t lvgl;
+	uint32_t fast;
+
+	lv_draw_line_dsc_init(&dsc);
+	dsc.width = 2;
+	dsc.color = lv_color_white();
+
+	/* The strokes of DRAW_MAIN, outside a refresh into a strip of our own */
+	_lv_refr_set_disp_refreshing(disp);
+	draw_ctx->buf = line_buf;
+	draw_ctx->buf_area = &area;
+	draw_ctx->clip_area = &area;
+
+	lvgl = bench_lines(draw_ctx, lv_draw_line, &dsc);
+	fast = bench_lines(draw_ctx, hud_draw_lv_line, &dsc);
+
+	draw_ctx->buf = buf;
+	draw_ctx->buf_area = buf_area;
+	draw_ctx->clip_area = clip_area;
+	_lv_refr_set_disp_refreshing(refreshing);
+
+	TC_PRINT("lines: lv_draw_line %u us, hud_draw_lv_line %u us for %u\n",
+		 cyc_to_us(lvgl), cyc_to_us(fast),
+		 (unsigned int)(LINE_REPEAT * ARRAY_SIZE(line_points)));
+}
+
+/* Any pixel of the 3x3 block around (x, y) differs from the background */
+static bool ladder_lit(uint16_t x, uint16_t y, uint16_t bg)
+{
+	for (int dy = -1; dy <= 1; dy++) {
+		for (int dx = -1; dx <= 1; dx++) {
+			if (st7735s_emul_get_pixel(emul, x + dx, y + dy) != bg) {
+				return true;
+			}
+		}
+	}
+
+	return false;
+}
+
+ZTEST(hud_scanline_bench, test_ladder_roll)
+{
+	/*
+	 * Ladder centered on the screen, the canvas 10 rows lower, its
+	 * center row one up for the odd height
+	 */
+	const uint16_t cx = 64;
+	const uint16_t cy = 64 + LV_PITCH_LADDER_CANVAS_Y_OFFSET - 1;
+	/* On the left half of the horizon rung */
+	const uint16_t arm = 30;
+	lv_obj_t *ladder;
+	uint16_t bg;
+
+	ladder = lv_pitch_ladder_create(lv_scr_act());
+	zassert_not_null(ladder);
+	lv_pitch_ladder_set_color(ladder, lv_color_make(0xff, 0x00, 0x00));
+
+	lv_pitch_ladder_set_angles(ladder, 0, 0);
+	lv_timer_handler();
+	lv_refr_now(NULL);
+
+	/* Inside the object, outside the ladder at any roll */
+	bg = st7735s_emul_get_pixel(emul, 28, 28);
+	zassert_true(ladder_lit(cx - arm, cy, bg));
+	zassert_false(ladder_lit(cx, cy - arm, bg));
+
+	/* Rolled by 90 degrees the rung stands upright above the center */
+	lv_pitch_ladder_set_angles(ladder, 0, 900);
+	lv_timer_handler();
+	lv_refr_now(NULL);
+
+	zassert_false(ladder_lit(cx - arm, cy, bg));
+	zassert_true(ladder_lit(cx, cy - arm, bg));
+
+	lv_obj_del(ladder);
+	lv_refr_now(NULL);
+}
+
+static void *hud_scanline_bench_setup(void)
+{
+	zassert_ok(hud_sl_init(&bench_ctx, display, bench_band,
+			       ARRAY_SIZE(bench_band)));
+
+	return NULL;
+}
+
+ZTEST_SUITE(hud_scanline_bench, NULL, hud_scanline_bench_setup, NULL, NULL,
+	    NULL);
@@ -0,0 +1,142 @@
+/*
+ * Copyright (c) 2024 kristosb
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/*
+ * @file test hud_scanline library
+ *
+ * This suite checks the band rasterizer on its own and a full frame sent
+ * through the st7735s driver to the panel emulator, the bands alternating
+ * between both buffers.
+ */
+
+#include <errno.h>
+
+#include <zephyr/ztest.h>
+#include <zephyr/device.h>
+#include <zephyr/drivers/emul.h>
+
+#include <app/drivers/display/emul_st7735s.h>
+#include <app/lib/hud_scanline.h>
+
+#define WHITE 0xffff
+
+static const struct device *const display =
+	DEVICE_DT_GET(DT_CHOSEN(zephyr_display));
+static const struct emul *const emul = EMUL_DT_GET(DT_CHOSEN(zephyr_display));
+
+HUD_SL_BAND_DEFINE(band, 128);
+static struct hud_sl_ctx ctx;
+
+static uint16_t band_px(uint16_t x, uint16_t row)
+{
+	return band[row * ctx.width + x];
+}
+
+ZTEST(hud_scanline, test_line_clipped_to_band)
+{
+	const struct hud_sl_prim prims[] = {
+		/* Horizontal, in the band */
+		HUD_SL_LINE(10, 3, 20, 3, 1, WHITE),
+		/* Vertical, crossing the band */
+		HUD_SL_LINE(40, -5, 40, 100, 1, WHITE),
+		/* Below the band */
+		HUD_SL_LINE(0, 50, 127, 50, 1, WHITE),
+	};
+
+	hud_sl_render_band(&ctx, 0, ctx.rows, prims, ARRAY_SIZE(prims));
+
+	zassert_equal(band_px(10, 3), WHITE);
+	zassert_equal(band_px(20, 3), WHITE);
+	zassert_equal(band_px(21, 3), 0);
+	zassert_equal(band_px(15, 2), 0);
+
+	for (uint16_t row = 0; row < ctx.rows; row++) {
+		zassert_equal(band_px(40, row), WHITE, "row %u", row);
+		zassert_equal(band_px(41, row), 0, "row %u", row);
+	}
+}
+
+ZTEST(hud_scanline, test_line_width)
+{
+	const struct hud_sl_prim prims[] = {
+		HUD_SL_LINE(10, 4, 30, 4, 2, WHITE),
+		HUD_SL_LINE(50, 0, 50, 7, 2, WHITE),
+	};
+
+	hud_sl_render_band(&ctx, 0, ctx.rows, prims, ARRAY_SIZE(prims));
+
+	/* Two rows for the shallow line, two columns for the steep one */
+	zassert_equal(band_px(20, 4), WHITE);
+	zassert_equal(band_px(20, 5), WHITE);
+	zassert_equal(band_px(20, 3), 0);
+	zassert_equal(band_px(50, 2), WHITE);
+	zassert_equal(band_px(51, 2), WHITE);
+	zassert_equal(band_px(49, 2), 0);
+}
+
+ZTEST(hud_scanline, test_text)
+{
+	const struct hud_sl_prim prims[] = {
+		HUD_SL_TEXT(0, 0, 1, WHITE, "1"),
+	};
+
+	hud_sl_render_band(&ctx, 0, ctx.rows, prims, ARRAY_SIZE(prims));
+
+	/* '1': stem in column 2, foot across columns 1-3 in row 6 */
+	for (uint16_t row = 0; row < 7; row++) {
+		zassert_equal(band_px(2, row), WHITE, "row %u", row);
+	}
+	zassert_equal(band_px(1, 1), WHITE);
+	zassert_equal(band_px(0, 6), 0);
+	zassert_equal(band_px(1, 6), WHITE);
+	zassert_equal(band_px(3, 6), WHITE);
+	zassert_equal(band_px(4, 6), 0);
+}
+
+ZTEST(hud_scanline, test_render_frame)
+{
+	const struct hud_sl_prim prims[] = {
+		HUD_SL_LINE(0, 0, 127, 127, 1, WHITE),
+		HUD_SL_TEXT(60, 100, 2, WHITE, "N"),
+	};
+	struct st7735s_emul_stats stats;
+
+	st7735s_emul_reset_stats(emul);
+	zassert_ok(hud_sl_render(&ctx, prims, ARRAY_SIZE(prims)));
+
+	zassert_equal(st7735s_emul_get_pixel(emul, 0, 0), WHITE);
+	zassert_equal(st7735s_emul_get_pixel(emul, 77, 77), WHITE);
+	zassert_equal(st7735s_emul_get_pixel(emul, 77, 78), 0);
+	/* 'N' left stem, scaled by 2 */
+	zassert_equal(st7735s_emul_get_pixel(emul, 61, 113), WHITE);
+
+	st7735s_emul_get_stats(emul, &stats);
+	zassert_equal(stats.pixels, 128 * 128);
+	zassert_equal(stats.windows, DIV_ROUND_UP(128, ctx.rows));
+}
+
+ZTEST(hud_scanline, test_init_two_bands)
+{
+	struct hud_sl_ctx small;
+
+	/* One row for each buffer at least */
+	zassert_equal(hud_sl_init(&small, display, band, 2 * 128 - 1), -EINVAL);
+	zassert_ok(hud_sl_init(&small, display, band, 2 * 128));
+	zassert_equal(small.rows, 1);
+	zassert_equal(small.band[1], &band[128]);
+
+	zassert_equal(ctx.band[0], band);
+	zassert_equal(ctx.band[1], &band[ctx.rows * 128]);
+}
+
+static void *hud_scanline_setup(void)
+{
+	zassert_ok(hud_sl_init(&ctx, display, band, ARRAY_SIZE(band)));
+
+	return NULL;
+}
+
+ZTEST_SUITE(hud_scanline, NULL, hud_scanline_setup, NULL, NULL, NULL);
@@ -0,0 +1,115 @@
+/*
+ * Copyright (c) 2024 kristosb
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/*
+ * @file test lv_glyph_atlas library
+ *
+ * This suite draws numbers from the atlas into a 1 bit buffer and checks
+ * them against what lv_canvas_draw_text() puts into a 1 bit canvas.
+ */
+
+#include <stdio.h>
+#include <string.h>
+
+#include <zephyr/ztest.h>
+#include <lvgl.h>
+
+#include <app/lib/lv_glyph_atlas.h>
+
+#define CANVAS_W 48
+#define CANVAS_H 20
+#define CANVAS_STRIDE ((CANVAS_W + 7) / 8)
+
+static uint8_t canvas_buf[CANVAS_STRIDE * CANVAS_H];
+static uint8_t atlas_out[CANVAS_STRIDE * CANVAS_H];
+static lv_draw_label_dsc_t label_dsc;
+
+static bool px(const uint8_t *buf, int x, int y)
+{
+	return buf[y * CANVAS_STRIDE + x / 8] & (0x80 >> (x & 7));
+}
+
+static void compare_with_canvas(int32_t value, bool pad)
+{
+	const lv_point_t pos = { 2, 2 };
+	lv_obj_t *canvas = lv_canvas_create(lv_scr_act());
+	char txt[16];
+	int set = 0;
+	int diff = 0;
+
+	lv_canvas_set_buffer(canvas, canvas_buf, CANVAS_W, CANVAS_H,
+			     LV_IMG_CF_ALPHA_1BIT);
+	lv_canvas_fill_bg(canvas, lv_color_black(), LV_OPA_TRANSP);
+	snprintf(txt, sizeof(txt), pad ? " %d" : "%d", value);
+	lv_canvas_draw_text(canvas, pos.x, pos.y, CANVAS_W, &label_dsc, txt);
+
+	memset(atlas_out, 0, sizeof(atlas_out));
+	zassert_equal(lv_glyph_atlas_draw_int_a1(atlas_out, CANVAS_W, CANVAS_H,
+						 &label_dsc, &pos, value, pad),
+		      LV_RES_OK);
+
+	for (int y = 0; y < CANVAS_H; y++) {
+		for (int x = 0; x < CANVAS_W; x++) {
+			set += px(canvas_buf, x, y);
+			diff += px(canvas_buf, x, y) != px(atlas_out, x, y);
+		}
+	}
+
+	/* Same glyphs, only the anti-aliasing threshold may differ */
+	zassert_true(set > 0, "\"%s\" not drawn", txt);
+	zassert_true(diff <= set / 10, "\"%s\": %d of %d pixels differ",
+		     txt, diff, set);
+
+	lv_obj_del(canvas);
+}
+
+ZTEST(lv_glyph_atlas, test_init)
+{
+	/* Shared, a second widget gets the same atlas */
+	zassert_equal(lv_glyph_atlas_init(label_dsc.font), LV_RES_OK);
+	zassert_equal(lv_glyph_atlas_init(NULL), LV_RES_INV);
+}
+
+ZTEST(lv_glyph_atlas, test_other_font)
+{
+	lv_draw_label_dsc_t dsc = label_dsc;
+	lv_font_t other = *label_dsc.font;
+	const lv_point_t pos = { 0, 0 };
+
+	dsc.font = &other;
+	zassert_equal(lv_glyph_atlas_draw_int_a1(atlas_out, CANVAS_W, CANVAS_H,
+						 &dsc, &pos, 10, false),
+		      LV_RES_INV, "the caller has to fall back to the font");
+}
+
+ZTEST(lv_glyph_atlas, test_matches_canvas_text)
+{
+	compare_with_canvas(0, false);
+	compare_with_canvas(350, false);
+	compare_with_canvas(-90, true);
+	compare_with_canvas(40, true);
+}
+
+ZTEST(lv_glyph_atlas, test_clipped)
+{
+	const lv_point_t pos = { CANVAS_W - 4, CANVAS_H - 6 };
+
+	/* Partly outside, must not write past the buffer */
+	memset(atlas_out, 0, sizeof(atlas_out));
+	zassert_equal(lv_glyph_atlas_draw_int_a1(atlas_out, CANVAS_W, CANVAS_H,
+						 &label_dsc, &pos, -88888, false),
+		      LV_RES_OK);
+}
+
+static void *lv_glyph_atlas_setup(void)
+{
+	lv_draw_label_dsc_init(&label_dsc);
+	zassert_equal(lv_glyph_atlas_init(label_dsc.font), LV_RES_OK);
+
+	return NULL;
+}
+
+ZTEST_SUITE(lv_glyph_atlas, NULL, lv_glyph_atlas_setup, NULL, NULL, NULL);